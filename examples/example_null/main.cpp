@@ -1,15 +1,1971 @@
 // dear imgui: "null" example application
 // (compile and link imgui, create context, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
 // This is useful to test building, but you cannot interact with anything here!
+// It also runs self-tests of features which are hard to exercise without inputs
+// (number parsing, occlusion culling, combo popup width, box-select, selection ranges, plot peaks, plot streams,
+// list clipper heights, tree views).
+// Build with 'make WITH_THREADS=1' to also run multiple contexts concurrently on multiple threads (using IMGUI_USE_THREAD_LOCAL_CONTEXT),
+// to benchmark job windows (misc/cpp/imgui_job_windows.h) with 1 to N worker threads, ImDrawListProducer (misc/cpp/imgui_threaded_rendering.h)
+// with 1 to 16 producer threads, ImGuiAsyncList (misc/cpp/imgui_async_list.h) against a data source with simulated latency,
+// ImGuiLogConsole (misc/cpp/imgui_log_console.h) with 1 to 4 threads appending lines, and to test ImGuiTextViewer (misc/cpp/imgui_text_viewer.h)
+// and benchmark it on a generated 256 MB file.
+// Build with 'make WITH_BENCHMARKS=1' to run micro-benchmarks of core features (child windows lookup, style colors, many windows, number formatting, occlusion culling, plotting, plot streams, variable height list clipping, multi-selection, tree views) with optimizations enabled.
 #include "imgui.h"
+#include "imgui_internal.h"     // DataTypeApplyOpFromText(), ImFormatString()
 #include <stdio.h>
+#include <string.h>
+#ifdef IMGUI_EXAMPLE_NULL_BENCHMARKS
+#include <chrono>
+#endif
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#include "../../misc/cpp/imgui_async_list.h"
+#include "../../misc/cpp/imgui_job_windows.h"
+#include "../../misc/cpp/imgui_log_console.h"
+#include "../../misc/cpp/imgui_threaded_rendering.h"
+#ifndef _WIN32
+#include "../../misc/cpp/imgui_text_viewer.h"  // POSIX only
+#endif
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <thread>
+#include <time.h>
+#endif
+
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+// Each thread creates its own context, sharing a single font atlas which was built and locked by the main thread.
+// We don't call ShowDemoWindow() here as imgui_demo.cpp stores its state in static variables.
+struct ThreadStats
+{
+    int     Frames;
+    double  Seconds;
+    int     Vertices;
+};
+
+static void RunContextOnThread(ImFontAtlas* shared_font_atlas, int thread_idx, int frames_count, ThreadStats* out_stats)
+{
+    ImGui::CreateContext(shared_font_atlas); // Sets current context for this thread
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+
+    float values[64];
+    float slider = 0.0f;
+    char buf[64] = "";
+    const std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+    for (int n = 0; n < frames_count; n++)
+    {
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.MousePos = ImVec2((float)((n * 7 + thread_idx * 100) % 1920), (float)((n * 3) % 1080));
+        ImGui::NewFrame();
+        for (int window_n = 0; window_n < 8; window_n++)
+        {
+            ImGui::SetNextWindowPos(ImVec2(window_n * 200.0f, window_n * 50.0f), ImGuiCond_FirstUseEver);
+            char window_name[32];
+            snprintf(window_name, IM_ARRAYSIZE(window_name), "Window %d", window_n);
+            ImGui::Begin(window_name);
+            ImGui::Text("Thread %d, frame %d", thread_idx, n);
+            ImGui::SliderFloat("float", &slider, 0.0f, 1.0f);
+            ImGui::InputText("text", buf, IM_ARRAYSIZE(buf));
+            for (int i = 0; i < IM_ARRAYSIZE(values); i++)
+                values[i] = (float)((i * 13 + n + window_n) % 37);
+            ImGui::PlotLines("plot", values, IM_ARRAYSIZE(values));
+            if (ImGui::TreeNode("Tree"))
+            {
+                for (int i = 0; i < 20; i++)
+                    ImGui::BulletText("Item %d", i);
+                ImGui::TreePop();
+            }
+            ImGui::End();
+        }
+        ImGui::Render();
+        out_stats->Vertices = ImGui::GetDrawData()->TotalVtxCount;
+    }
+    out_stats->Frames = frames_count;
+    out_stats->Seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+    ImGui::DestroyContext();
+}
+
+static void RunContextsOnThreads(int threads_count, int frames_count)
+{
+    ImFontAtlas shared_font_atlas;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    shared_font_atlas.GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    shared_font_atlas.Locked = true; // Read-only from now on
+
+    ThreadStats stats[16];
+    std::thread threads[16];
+    IM_ASSERT(threads_count <= IM_ARRAYSIZE(threads));
+    for (int n = 0; n < threads_count; n++)
+        threads[n] = std::thread(RunContextOnThread, &shared_font_atlas, n, frames_count, &stats[n]);
+    for (int n = 0; n < threads_count; n++)
+        threads[n].join();
+    for (int n = 0; n < threads_count; n++)
+        printf("Thread %d: %d frames in %.3f s (%.0f frames/s), %d vertices\n", n, stats[n].Frames, stats[n].Seconds, stats[n].Frames / stats[n].Seconds, stats[n].Vertices);
+    shared_font_atlas.Locked = false;
+}
+
+// Job windows: the contents of each panel are recorded on worker threads while the main thread submits the other panels.
+// The output only depends on submission order, so we also verify that it is identical for every number of threads.
+struct JobPanel
+{
+    int     Idx;
+    float   Values[8];
+};
+
+static void JobPanelContents(void* user_data)
+{
+    JobPanel* panel = (JobPanel*)user_data;
+    for (int i = 0; i < 100; i++)
+    {
+        ImGui::PushID(i);
+        if (i % 3 == 0)
+            ImGui::Text("Panel %d, item %d: %.3f", panel->Idx, i, panel->Values[i % 8]);
+        else if (i % 3 == 1)
+            ImGui::Button("Button");
+        else
+            ImGui::SliderFloat("##value", &panel->Values[i % 8], 0.0f, 1.0f);
+        ImGui::PopID();
+    }
+}
+
+static unsigned int HashDrawData(const ImDrawData* draw_data)
+{
+    unsigned int hash = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        for (int vtx_n = 0; vtx_n < draw_list->VtxBuffer.Size; vtx_n++)
+            hash = hash * 31 + (unsigned int)(draw_list->VtxBuffer[vtx_n].pos.x * 8.0f) + (unsigned int)(draw_list->VtxBuffer[vtx_n].pos.y * 8.0f) * 7 + draw_list->VtxBuffer[vtx_n].col;
+    }
+    return hash;
+}
+
+static void RunJobWindows(int threads_count, int frames_count, unsigned int* out_hash)
+{
+    const int PANELS_COUNT = 40;
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    ImGuiJobWindows job_windows;
+    job_windows.Init(threads_count);
+    static ImGuiJobWindow job_panels[PANELS_COUNT];
+    static JobPanel panels[PANELS_COUNT];
+    for (int n = 0; n < PANELS_COUNT; n++)
+    {
+        panels[n].Idx = n;
+        for (int i = 0; i < 8; i++)
+            panels[n].Values[i] = i * 0.1f;
+    }
+
+    double seconds = 0.0;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.MousePos = ImVec2((float)((frame_n * 7) % 1920), (float)((frame_n * 3) % 1080));
+        const std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        ImGui::NewFrame();
+        for (int n = 0; n < PANELS_COUNT; n++)
+        {
+            char window_name[32];
+            snprintf(window_name, IM_ARRAYSIZE(window_name), "Panel %d", n);
+            ImGui::SetNextWindowPos(ImVec2((n % 8) * 240.0f, (n / 8) * 200.0f));
+            ImGui::SetNextWindowSize(ImVec2(230.0f, 190.0f));
+            ImGui::Begin(window_name, NULL, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
+            job_windows.Submit(&job_panels[n], JobPanelContents, &panels[n]);
+            ImGui::End();
+        }
+        ImGui::Render();
+        if (frame_n >= 10) // Skip warm-up
+            seconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+    }
+    *out_hash = HashDrawData(ImGui::GetDrawData());
+    printf("Job windows, %d worker threads: %.3f ms/frame, draw data hash %08X\n", threads_count, seconds * 1000.0 / (frames_count - 10), *out_hash);
+
+    job_windows.Shutdown();
+    for (int n = 0; n < PANELS_COUNT; n++)
+        job_panels[n].DestroyContext();
+    ImGui::DestroyContext();
+}
+
+// Producer threads continuously draw a waveform and markers into their ImDrawListProducer, while the UI thread renders frames
+// which append the latest geometry of every producer into a window. Nobody waits: producers and UI run at their own pace.
+static void RunDrawListProducer(ImDrawListProducer* producer, int thread_idx, std::atomic<bool>* stop)
+{
+    ImVec2 points[512];
+    for (int n = 0; !stop->load(std::memory_order_relaxed); n++)
+    {
+        for (int i = 0; i < IM_ARRAYSIZE(points); i++)
+            points[i] = ImVec2((float)i, 50.0f + 40.0f * sinf((i + n) * 0.05f + thread_idx));
+        ImDrawList* draw_list = producer->Begin();
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(255, 255, 0, 255), false, 1.0f);
+        for (int i = 0; i < 16; i++)
+            draw_list->AddCircleFilled(points[i * 32], 3.0f, IM_COL32(255, 0, 0, 255));
+        draw_list->AddText(ImVec2(0.0f, 0.0f), IM_COL32_WHITE, "Producer");
+        producer->End();
+    }
+}
+
+static void RunDrawListProducers(int threads_count, int frames_count)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    ImDrawListProducer producers[16];
+    std::thread threads[16];
+    std::atomic<bool> stop(false);
+    IM_ASSERT(threads_count <= IM_ARRAYSIZE(threads));
+    ImGui::NewFrame();
+    for (int n = 0; n < threads_count; n++)
+        producers[n].Init();
+    ImGui::Render();
+    for (int n = 0; n < threads_count; n++)
+        threads[n] = std::thread(RunDrawListProducer, &producers[n], n, &stop);
+
+    // Wait for every producer to publish once, so we measure the steady state and not thread startup
+    int published_begin = 0, acquired_begin = 0;
+    for (int n = 0; n < threads_count; n++)
+    {
+        while (producers[n]._PublishCount.load() == 0)
+            std::this_thread::yield();
+        published_begin += producers[n]._PublishCount;
+        acquired_begin += producers[n]._AcquireCount;
+    }
+
+    // The UI thread runs at a fixed rate of 500 frames/s (as if waiting for vsync), leaving the rest of the time to producers
+    const std::chrono::microseconds frame_period(2000);
+    double seconds_consume = 0.0;
+    const std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        std::this_thread::sleep_until(t0 + frame_period * frame_n);
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+        ImGui::Begin("Producers");
+        const std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        for (int n = 0; n < threads_count; n++)
+            producers[n].AddToDrawList(draw_list, ImVec2(origin.x + (n % 3) * 520.0f, origin.y + (n / 3) * 100.0f));
+        seconds_consume += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t1).count();
+        ImGui::End();
+        ImGui::Render();
+    }
+    int published = -published_begin, acquired = -acquired_begin;
+    for (int n = 0; n < threads_count; n++)
+    {
+        published += producers[n]._PublishCount;
+        acquired += producers[n]._AcquireCount;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+    stop = true;
+    for (int n = 0; n < threads_count; n++)
+        threads[n].join();
+    printf("Draw list producers, %2d threads: %8.0f draw lists/s published, %5.0f acquired/s, %.3f ms/frame appending %d vertices\n",
+        threads_count, published / seconds, acquired / seconds, seconds_consume * 1000.0 / frames_count, ImGui::GetDrawData()->TotalVtxCount);
+    for (int n = 0; n < threads_count; n++)
+        producers[n].Shutdown();
+    ImGui::DestroyContext();
+}
+
+// A data source which takes 'LatencyMs' per request, whatever the number of rows, e.g. a database query.
+struct AsyncListRow
+{
+    int     Id;
+    float   Value;
+    char    Name[24];
+};
+
+static void FetchRowsWithLatency(void* user_data, int row_begin, int row_end, void* out_rows)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(*(const int*)user_data));
+    AsyncListRow* rows = (AsyncListRow*)out_rows;
+    for (int row_n = row_begin; row_n < row_end; row_n++, rows++)
+    {
+        rows->Id = row_n;
+        rows->Value = sinf(row_n * 0.01f);
+        snprintf(rows->Name, IM_ARRAYSIZE(rows->Name), "Row %d", row_n);
+    }
+}
+
+// Scroll through a list of 1M rows at 60 FPS (paced), about 10 rows per frame with a Page Down every 30 frames,
+// measuring the time spent by the UI thread on the list and the ratio of visible rows which weren't loaded yet.
+static void RunAsyncList(int threads_count, int frames_count)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    static int latency_ms = 10;
+    ImGuiAsyncList list;
+    list.Init(1000000, sizeof(AsyncListRow), FetchRowsWithLatency, &latency_ms, threads_count);
+    double seconds = 0.0, seconds_max = 0.0;
+    int rows_visible = 0, rows_missing = 0;
+    std::chrono::high_resolution_clock::time_point frame_time = std::chrono::high_resolution_clock::now();
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(800, 1000));
+        ImGui::Begin("Async List");
+        if (frame_n > 0)
+            ImGui::SetScrollY(ImGui::GetScrollY() + ((frame_n % 30 == 0) ? ImGui::GetWindowHeight() : 200.0f));
+        const std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        ImGuiListClipper clipper;
+        clipper.Begin(list.RowsCount, ImGui::GetTextLineHeightWithSpacing());
+        while (clipper.Step())
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                rows_visible += (frame_n >= 10) ? 1 : 0;
+                if (const AsyncListRow* row = (const AsyncListRow*)list.GetRow(row_n))
+                    ImGui::Text("%d %s %.3f", row->Id, row->Name, row->Value);
+                else
+                    list.RenderPlaceholder();
+            }
+        list.Update();
+        const double seconds_frame = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+        if (frame_n >= 10) // Skip warm-up
+        {
+            seconds += seconds_frame;
+            seconds_max = (seconds_frame > seconds_max) ? seconds_frame : seconds_max;
+            rows_missing += list.MissingRowsCount;
+        }
+        ImGui::End();
+        ImGui::Render();
+        frame_time += std::chrono::microseconds(16667);
+        std::this_thread::sleep_until(frame_time);
+    }
+    printf("Async list, %d worker threads, %d ms latency: %.3f ms/frame (max %.3f ms) on the UI thread, %.1f%% of visible rows not loaded, %d pages fetched\n",
+        threads_count, latency_ms, seconds * 1000.0 / (frames_count - 10), seconds_max * 1000.0, rows_missing * 100.0 / rows_visible, list.FetchedPagesCount);
+    list.Shutdown();
+    ImGui::DestroyContext();
+}
+
+// Change the number of rows every frame while worker threads fetch pages (e.g. a list being filtered), checking the rows returned.
+// Build with -fsanitize=thread to check that worker threads never read RowsCount while SetRowsCount() writes it.
+static void RunAsyncListTests()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    static int latency_ms = 0;
+    ImGuiAsyncList list;
+    list.Init(1000, sizeof(AsyncListRow), FetchRowsWithLatency, &latency_ms, 2, 16, 16);
+    for (int frame_n = 0; frame_n < 500; frame_n++)
+    {
+        ImGui::NewFrame();
+        list.SetRowsCount(100 + (frame_n * 37) % 300);
+        for (int row_n = 0; row_n < list.RowsCount; row_n += 7)
+            if (const AsyncListRow* row = (const AsyncListRow*)list.GetRow(row_n))
+                IM_ASSERT(row->Id == row_n && "GetRow() should return the requested row");
+        list.Update();
+        ImGui::EndFrame();
+        std::this_thread::yield();
+    }
+    list.Shutdown();
+    ImGui::DestroyContext();
+    printf("Async list tests passed\n");
+}
+
+// Threads append lines as fast as they can into a 16 MB log console, while the UI thread displays it at 60 FPS (paced),
+// typing a filter one character at a time every 20 frames, measuring the time spent by the UI thread on the console.
+// CPU time used by the calling thread, to tell its own work from the time it was preempted by other threads. 0.0 when not available.
+static double GetThreadCpuTimeInSeconds()
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+    return 0.0;
+}
+
+static void RunLogConsole(int threads_count, int frames_count)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    ImGuiLogConsole* log = IM_NEW(ImGuiLogConsole)(16 * 1024 * 1024);
+    std::atomic<bool> stop(false);
+    std::atomic<long long> lines_count(0);
+    std::vector<std::thread> threads;
+    for (int thread_n = 0; thread_n < threads_count; thread_n++)
+        threads.emplace_back([log, &stop, &lines_count, thread_n]()
+        {
+            long long n = 0;
+            for (; !stop; n++)
+                log->AddLog("[%08lld] [%s] Message from thread %d, value=%f", n, (n % 100 == 0) ? "error" : "info", thread_n, n * 0.5);
+            lines_count += n;
+        });
+
+    const char* filter = "error";
+    double seconds = 0.0, seconds_max = 0.0, cpu_seconds = 0.0, cpu_seconds_max = 0.0;
+    std::chrono::high_resolution_clock::time_point frame_time = std::chrono::high_resolution_clock::now();
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        if (frame_n % 20 == 0 && frame_n / 20 < 5)
+        {
+            snprintf(log->Filter.InputBuf, IM_ARRAYSIZE(log->Filter.InputBuf), "%.*s", frame_n / 20 + 1, filter);
+            log->Filter.Build();
+        }
+        ImGui::NewFrame();
+        const std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        const double cpu_t0 = GetThreadCpuTimeInSeconds();
+        log->Draw("Log");
+        const double cpu_seconds_frame = GetThreadCpuTimeInSeconds() - cpu_t0;
+        const double seconds_frame = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+        seconds += seconds_frame;
+        seconds_max = (seconds_frame > seconds_max) ? seconds_frame : seconds_max;
+        cpu_seconds += cpu_seconds_frame;
+        cpu_seconds_max = (cpu_seconds_frame > cpu_seconds_max) ? cpu_seconds_frame : cpu_seconds_max;
+        ImGui::Render();
+        frame_time += std::chrono::microseconds(16667);
+        std::this_thread::sleep_until(frame_time);
+    }
+    stop = true;
+    for (size_t n = 0; n < threads.size(); n++)
+        threads[n].join();
+    const int matches_during_load = log->FilteredLines.Size - log->FilteredBegin;
+
+    // Let the filter catch up with the lines added faster than it could test them, then check its results against every stored line
+    int catch_up_frames = 0;
+    for (; catch_up_frames < 1000 && (catch_up_frames == 0 || log->IsFiltering()); catch_up_frames++)
+    {
+        ImGui::NewFrame();
+        log->Draw("Log");
+        ImGui::Render();
+    }
+    int matches_expected = 0;
+    for (ImS64 line_no = log->FirstLine; line_no < log->GetEndLine(); line_no++)
+    {
+        const char* line_begin;
+        const char* line_end;
+        log->GetLine(line_no, &line_begin, &line_end);
+        matches_expected += log->Filter.PassFilter(line_begin, line_end) ? 1 : 0;
+    }
+    const int matches = log->FilteredLines.Size - log->FilteredBegin;
+    IM_ASSERT(!log->IsFiltering() && matches == matches_expected);
+    printf("Log console, %d threads appending: %.2fM lines/s, %.3f ms/frame (max %.3f ms) on the UI thread, of which %.3f ms (max %.3f ms) of CPU time\n",
+        threads_count, lines_count * 60.0 / frames_count / 1000000.0, seconds * 1000.0 / frames_count, seconds_max * 1000.0, cpu_seconds * 1000.0 / frames_count, cpu_seconds_max * 1000.0);
+    printf("Log console, %d threads appending: %d lines stored, %d matching '%s' (%d when the appends stopped, %d frames to catch up)\n",
+        threads_count, (int)log->GetLinesCount(), matches, log->Filter.InputBuf, matches_during_load, catch_up_frames);
+    IM_DELETE(log);
+    ImGui::DestroyContext();
+}
+
+#ifndef _WIN32
+// Generate a 256 MB log file, display it while it is indexed, then jump to random lines and search for the last line,
+// measuring the time spent by the UI thread on the viewer.
+static void RunTextViewer(int frames_count)
+{
+    const char* filename = "example_null_text_viewer.tmp";
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+        return;
+    long long lines_count = 0;
+    for (long long bytes = 0; bytes < 256 * 1024 * 1024; lines_count++)
+        bytes += fprintf(f, "%lld,2020-10-%02d,user%lld,%s,%f\n", lines_count, (int)(lines_count % 28) + 1, lines_count % 1000, (lines_count % 100 == 0) ? "error" : "info", lines_count * 0.5);
+    fprintf(f, "last line");
+    fclose(f);
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    ImGuiTextViewer* viewer = IM_NEW(ImGuiTextViewer)();
+    const std::chrono::high_resolution_clock::time_point t_open = std::chrono::high_resolution_clock::now();
+    viewer->Open(filename);
+    double seconds = 0.0, seconds_max = 0.0, seconds_index = 0.0, seconds_search = 0.0;
+    std::chrono::high_resolution_clock::time_point frame_time = t_open, t_search = t_open;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        if (seconds_index == 0.0 && !viewer->IsIndexing())
+            seconds_index = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t_open).count();
+        if (frame_n >= frames_count / 2 && frame_n % 10 == 0)
+            viewer->ScrollToLine = (lines_count * (frame_n * 7919 % 1000)) / 1000;
+        if (frame_n == frames_count - 30)
+        {
+            t_search = std::chrono::high_resolution_clock::now();
+            viewer->Search("last line", true, 0);
+        }
+        if (frame_n > frames_count - 30 && seconds_search == 0.0 && viewer->SearchResult.load() != -2)
+            seconds_search = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t_search).count();
+        ImGui::NewFrame();
+        const std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        viewer->Draw(filename);
+        const double seconds_frame = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+        seconds += seconds_frame;
+        seconds_max = (seconds_frame > seconds_max) ? seconds_frame : seconds_max;
+        ImGui::Render();
+        frame_time += std::chrono::microseconds(16667);
+        std::this_thread::sleep_until(frame_time);
+    }
+    printf("Text viewer, 256 MB file: %lld lines indexed in %.0f ms, found last line in %.0f ms, %.3f ms/frame (max %.3f ms) on the UI thread\n",
+        (long long)viewer->GetLinesCount(), seconds_index * 1000.0, seconds_search * 1000.0, seconds * 1000.0 / frames_count, seconds_max * 1000.0);
+    IM_DELETE(viewer);
+    ImGui::DestroyContext();
+    remove(filename);
+}
+
+static void DrawTextViewerFrames(ImGuiTextViewer* viewer, int frames_count)
+{
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(ImVec2(800.0f, 600.0f));
+        viewer->Draw("Text viewer");
+        ImGui::Render();
+    }
+}
+
+// Check that malformed UTF-8 is displayed and searched, and that scrolling moves by exactly one line past 2^24 lines
+// (where float positions can't address lines anymore).
+// Reference for ImGuiTextViewerFindText(): compare at every position, ASCII letters case insensitive when requested
+static const char* FindTextBruteForce(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end, bool case_sensitive)
+{
+    const int len = (int)(needle_end - needle);
+    for (const char* p = haystack; p + len <= haystack_end; p++)
+    {
+        int n = 0;
+        for (; n < len; n++)
+        {
+            unsigned char a = (unsigned char)p[n], b = (unsigned char)needle[n];
+            if (!case_sensitive)
+            {
+                a = (a >= 'A' && a <= 'Z') ? (unsigned char)(a + 'a' - 'A') : a;
+                b = (b >= 'A' && b <= 'Z') ? (unsigned char)(b + 'a' - 'A') : b;
+            }
+            if (a != b)
+                break;
+        }
+        if (n == len)
+            return p;
+    }
+    return NULL;
+}
+
+// Return the offset of the match, -1 if none
+static int FindTextOffset(const char* haystack, const char* needle, bool case_sensitive)
+{
+    const char* haystack_end = haystack + strlen(haystack);
+    const char* match = ImGuiTextViewerFindText(haystack, haystack_end, needle, needle + strlen(needle), case_sensitive);
+    IM_ASSERT(match == FindTextBruteForce(haystack, haystack_end, needle, needle + strlen(needle), case_sensitive));
+    return match ? (int)(match - haystack) : -1;
+}
+
+static void RunTextViewerTests()
+{
+    const char* filename = "example_null_text_viewer_tests.tmp";
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGuiTextViewer* viewer = IM_NEW(ImGuiTextViewer)();
+
+    // Case insensitive search only folds ASCII letters, e.g. not '@' and '`' which differ by the same bit.
+    // Build with 'make WITH_SSE=0' to test the search without SSE2.
+    IM_ASSERT(FindTextOffset("xx1Axx", "1a", false) == 2 && FindTextOffset("xx1Axx", "1a", true) == -1);
+    IM_ASSERT(FindTextOffset("xxa1xx", "A1", false) == 2 && FindTextOffset("say hELLO", "Hello", false) == 4);
+    IM_ASSERT(FindTextOffset("x@x[", "`", false) == -1 && FindTextOffset("x@x[", "{", false) == -1 && FindTextOffset("x@x[", "X[", false) == 2);
+    char haystack[64], needle[8];
+    const char alphabet[] = "aAbB1@`[{";
+    unsigned int seed = 1;
+    for (int n = 0; n < 200000; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int haystack_len = (int)((seed >> 8) % 48), needle_len = 1 + (int)((seed >> 16) % 4);
+        for (int i = 0; i < haystack_len + needle_len; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const char c = alphabet[(seed >> 12) % (IM_ARRAYSIZE(alphabet) - 1)];
+            if (i < haystack_len)
+                haystack[i] = c;
+            else
+                needle[i - haystack_len] = c;
+        }
+        haystack[haystack_len] = needle[needle_len] = 0;
+        FindTextOffset(haystack, needle, (n & 1) != 0);
+    }
+
+    // Stray bytes are one invalid character each
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+        return;
+    fprintf(f, "25\xB0 C \xFF hello world\n");
+    fclose(f);
+    viewer->Open(filename);
+    while (viewer->IsIndexing())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    viewer->Search("hello", true, 0);
+    while (viewer->SearchResult.load() == -2)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    DrawTextViewerFrames(viewer, 3);
+    IM_ASSERT(viewer->SearchMatchLength == 5 && viewer->SearchMatchOffset == 8);
+    viewer->Search("HELLO", false, 0);
+    while (viewer->SearchResult.load() == -2)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    DrawTextViewerFrames(viewer, 3);
+    IM_ASSERT(viewer->SearchMatchLength == 5 && viewer->SearchMatchOffset == 8);
+
+    // 40M empty lines
+    f = fopen(filename, "wb");
+    if (!f)
+        return;
+    const ImS64 lines_count = 40 * 1000 * 1000;
+    static char newlines[1024 * 1024];
+    memset(newlines, '\n', sizeof(newlines));
+    for (ImS64 n = 0; n < lines_count; n += sizeof(newlines))
+        fwrite(newlines, 1, (size_t)((lines_count - n < (ImS64)sizeof(newlines)) ? lines_count - n : (ImS64)sizeof(newlines)), f);
+    fclose(f);
+    viewer->Open(filename);
+    while (viewer->IsIndexing())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    IM_ASSERT(viewer->GetLinesCount() == lines_count);
+    int failures = 0;
+    for (ImS64 line_n = lines_count - 1001; line_n < lines_count - 1000 + 16; line_n++)
+    {
+        viewer->ScrollToLine = line_n;
+        DrawTextViewerFrames(viewer, 1);
+        const ImS64 visible_begin = viewer->VisibleLinesBegin;
+        viewer->ScrollToLine = line_n + 1;
+        DrawTextViewerFrames(viewer, 1);
+        if (viewer->VisibleLinesBegin != visible_begin + 1 || line_n + 1 < viewer->VisibleLinesBegin || line_n + 1 >= viewer->VisibleLinesEnd)
+            failures++;
+    }
+    viewer->ScrollToLine = lines_count - 1;
+    DrawTextViewerFrames(viewer, 1);
+    if (viewer->VisibleLinesEnd != lines_count)
+        failures++;
+    printf("Text viewer tests: %d failures\n", failures);
+    IM_ASSERT(failures == 0);
+
+    IM_DELETE(viewer);
+    ImGui::DestroyContext();
+    remove(filename);
+}
+#endif // #ifndef _WIN32
+#endif
+
+// Check that integers formatted with each supported format are parsed back to the same value by DataTypeApplyOpFromText(),
+// then check clamping and wrapping of out of range values, and feed random strings to the parser.
+static void SetScalarFromBits(ImGuiDataType data_type, void* p_data, ImU64 bits)
+{
+    switch (data_type)
+    {
+    case ImGuiDataType_S8:  *(ImS8*)p_data  = (ImS8)bits;  break;
+    case ImGuiDataType_U8:  *(ImU8*)p_data  = (ImU8)bits;  break;
+    case ImGuiDataType_S16: *(ImS16*)p_data = (ImS16)bits; break;
+    case ImGuiDataType_U16: *(ImU16*)p_data = (ImU16)bits; break;
+    case ImGuiDataType_S32: *(ImS32*)p_data = (ImS32)bits; break;
+    case ImGuiDataType_U32: *(ImU32*)p_data = (ImU32)bits; break;
+    case ImGuiDataType_S64: *(ImS64*)p_data = (ImS64)bits; break;
+    case ImGuiDataType_U64: *(ImU64*)p_data = bits;        break;
+    default: IM_ASSERT(0);
+    }
+}
+
+static bool TestParseScalar(ImGuiDataType data_type, const char* format, const char* text, ImU64 expected_bits)
+{
+    ImU64 v = 0, expected = 0;
+    SetScalarFromBits(data_type, &expected, expected_bits);
+    ImGui::DataTypeApplyOpFromText(text, "", data_type, &v, format);
+    return memcmp(&v, &expected, sizeof(v)) == 0;
+}
+
+static void RunNumberParsingTests()
+{
+    struct TypeFormats { ImGuiDataType DataType; const char* Formats[5]; };
+    const TypeFormats types[] =
+    {
+        { ImGuiDataType_S8,  { "%d", "%u", "%X", "%08X", "%o" } },
+        { ImGuiDataType_U8,  { "%d", "%u", "%X", "%02x", "%o" } },
+        { ImGuiDataType_S16, { "%d", "%u", "%X", "%04X", "%i" } },
+        { ImGuiDataType_U16, { "%d", "%u", "%X", "%o",   "%i" } },
+        { ImGuiDataType_S32, { "%d", "%u", "%X", "%08X", "%i" } },
+        { ImGuiDataType_U32, { "%u", "%X", "%08x", "%o", "0x%X" } },
+        { ImGuiDataType_S64, { "%lld", "%llu", "%llX", "%016llX", "%lli" } },
+        { ImGuiDataType_U64, { "%llu", "%llX", "%016llx", "%llo", "%llu" } },
+    };
+    ImU64 seed = 1;
+    char buf[64];
+    for (int type_n = 0; type_n < IM_ARRAYSIZE(types); type_n++)
+        for (int format_n = 0; format_n < IM_ARRAYSIZE(types[type_n].Formats); format_n++)
+            for (int n = 0; n < 20000; n++)
+            {
+                // Mix uniformly random bits with small values and values around the type limits
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                ImU64 bits = seed >> (n % 4 == 0 ? 60 : n % 4 == 1 ? 16 : 0);
+                if (n % 4 == 3)
+                    bits = (ImU64)0 - bits;
+                const ImGuiDataType data_type = types[type_n].DataType;
+                const char* format = types[type_n].Formats[format_n];
+                ImU64 v = 0;
+                SetScalarFromBits(data_type, &v, bits);
+                ImGui::DataTypeFormatString(buf, IM_ARRAYSIZE(buf), data_type, &v, format);
+                IM_ASSERT(TestParseScalar(data_type, format, buf, bits) && "Value should round-trip through its format");
+            }
+
+    // Hexadecimal and unsigned 32/64-bit conversions wrap around to the width of the type, other decimal values are clamped
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S32, "%08X", "FFFFFFFF", (ImU64)-1));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S32, "%08X", "1FFFFFFFE", (ImU64)-2));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S64, "%llX", "FFFFFFFFFFFFFFFF", (ImU64)-1));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S8, "%X", "FF", (ImU64)-1));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U32, "%u", "-1", 0xFFFFFFFF));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U32, "%u", "4294967296", 0));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S32, "%d", "99999999999", 0x7FFFFFFF));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S32, "%d", "-99999999999", (ImU64)(ImS32)0x80000000));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S8, "%d", "-300", (ImU64)-128));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U8, "%d", "300", 255));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U8, "%d", "-1", 0));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S64, "%lld", "-9223372036854775808", (ImU64)1 << 63));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S64, "%lld", "99999999999999999999999", ~((ImU64)1 << 63)));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U64, "%llu", "18446744073709551615", ~(ImU64)0));
+
+    // Each type's default format (NULL), as used by InputScalar()/DragScalar()
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S8, NULL, "-300", (ImU64)-128));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U8, NULL, "300", 255));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U8, NULL, "-1", 0));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S16, NULL, "40000", 0x7FFF));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U16, NULL, "70000", 65535));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U16, NULL, "-1", 0));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S32, NULL, "-3000000000", (ImU64)(ImS32)0x80000000));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U32, NULL, "-1", 0xFFFFFFFF));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_S64, NULL, "-12", (ImU64)-12));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U64, NULL, "12", 12));
+    IM_ASSERT(TestParseScalar(ImGuiDataType_U8, "%X", "1FE", 0xFE));
+
+    // Floats and doubles round-trip through the shortest decimal representation which reads back exactly ("%.9g" and "%.17g"),
+    // for random bit patterns including denormals
+    for (int n = 0; n < 200000; n++)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const ImU32 bits_f = (ImU32)(seed >> 32);
+        const ImU64 bits_d = seed ^ (seed >> 29);
+        float f, f_parsed = 0.0f;
+        double d, d_parsed = 0.0;
+        memcpy(&f, &bits_f, sizeof(f));
+        memcpy(&d, &bits_d, sizeof(d));
+        if (f == f && f - f == 0.0f) // Finite
+        {
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "%.9g", f);
+            IM_ASSERT(ImParseFloat(buf, &f_parsed) && memcmp(&f, &f_parsed, sizeof(f)) == 0 && "Float should round-trip through \"%.9g\"");
+        }
+        if (d == d && d - d == 0.0)
+        {
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "%.17g", d);
+            IM_ASSERT(ImParseDouble(buf, &d_parsed) && memcmp(&d, &d_parsed, sizeof(d)) == 0 && "Double should round-trip through \"%.17g\"");
+        }
+    }
+
+    // Operators, and random strings which should never crash nor write to the value when no number can be read
+    int v32 = 10;
+    IM_ASSERT(ImGui::DataTypeApplyOpFromText("+-3", "10", ImGuiDataType_S32, &v32, "%d") && v32 == 7);
+    IM_ASSERT(ImGui::DataTypeApplyOpFromText("+1", "7FFFFFFF", ImGuiDataType_S32, &v32, "%X") && v32 == 0x7FFFFFFF);
+    IM_ASSERT(!ImGui::DataTypeApplyOpFromText("garbage", "", ImGuiDataType_S32, &v32, "%d") && v32 == 0x7FFFFFFF);
+    const char alphabet[] = "0123456789aAfFxX+- .\t";
+    for (int n = 0; n < 200000; n++)
+    {
+        int len = 0;
+        for (seed = seed * 6364136223846793005ULL + 1442695040888963407ULL; len < (int)(seed >> 60); len++)
+            buf[len] = alphabet[(seed >> (len * 4 % 56)) % (IM_ARRAYSIZE(alphabet) - 1)];
+        buf[len] = 0;
+        ImU64 v = 0;
+        ImGui::DataTypeApplyOpFromText(buf, "12", (ImGuiDataType)(n % ImGuiDataType_COUNT), &v, NULL);
+    }
+    printf("Number parsing tests passed\n");
+}
+
+// Tests and benchmarks below each create their own context, with a 1920x1080 display and no .ini file
+static void CreateTestContext()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+}
+
+static void TestNewFrame()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+}
+
+// Submit a window covering the whole display, opaque unless a lower background alpha is given. Return the value of Begin().
+static bool SubmitFullscreenWindow(const char* name, ImGuiWindowFlags flags = 0, float bg_alpha = 1.0f)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+    const bool visible = ImGui::Begin(name, NULL, flags);
+    if (visible)
+        ImGui::Text("Contents of %s", name);
+    ImGui::End();
+    return visible;
+}
+
+static int RenderAndCountDrawLists()
+{
+    ImGui::Render();
+    return ImGui::GetDrawData()->CmdListsCount;
+}
+
+// Check which windows io.ConfigWindowsOcclusionCulling culls, and that windows the user interacts with are never culled
+static void RunOcclusionCullingTests()
+{
+    CreateTestContext();
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigWindowsOcclusionCulling = true;
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+        io.KeyMap[key] = key;
+
+    // "Top" is created last so it is displayed above "Bottom"
+    TestNewFrame();
+    IM_ASSERT(SubmitFullscreenWindow("Bottom"));
+    IM_ASSERT(SubmitFullscreenWindow("Top"));
+    ImGui::Render();
+
+    // Occluder submitted first: Begin() skips the contents of the covered window
+    for (int n = 0; n < 3; n++)
+    {
+        TestNewFrame();
+        IM_ASSERT(SubmitFullscreenWindow("Top"));
+        const bool bottom_visible = SubmitFullscreenWindow("Bottom");
+        IM_ASSERT(!bottom_visible && g.WindowsOccludedCount == 1);
+        IM_ASSERT(RenderAndCountDrawLists() == 1);
+    }
+
+    // Occluder submitted last: Begin() can't know yet, but the draw list of the covered window is left out
+    TestNewFrame();
+    IM_ASSERT(SubmitFullscreenWindow("Bottom"));
+    IM_ASSERT(SubmitFullscreenWindow("Top"));
+    IM_ASSERT(RenderAndCountDrawLists() == 1 && g.WindowsOccludedCount == 1);
+
+    // Occluder closed: the covered window is displayed on the same frame, without leaving a blank frame
+    TestNewFrame();
+    IM_ASSERT(SubmitFullscreenWindow("Bottom"));
+    IM_ASSERT(RenderAndCountDrawLists() == 1 && g.WindowsOccludedCount == 0);
+
+    // Translucent occluder
+    for (int n = 0; n < 3; n++)
+    {
+        TestNewFrame();
+        IM_ASSERT(SubmitFullscreenWindow("Top", 0, 0.5f));
+        IM_ASSERT(SubmitFullscreenWindow("Bottom"));
+        IM_ASSERT(RenderAndCountDrawLists() == 2);
+    }
+
+    // Focused window staying behind its occluder (ImGuiWindowFlags_NoBringToFrontOnFocus): keyboard navigation needs its items
+    TestNewFrame();
+    IM_ASSERT(SubmitFullscreenWindow("Top"));
+    ImGui::SetNextWindowFocus();
+    IM_ASSERT(SubmitFullscreenWindow("Bottom", ImGuiWindowFlags_NoBringToFrontOnFocus));
+    ImGui::Render();
+    for (int n = 0; n < 3; n++)
+    {
+        TestNewFrame();
+        IM_ASSERT(SubmitFullscreenWindow("Top"));
+        IM_ASSERT(SubmitFullscreenWindow("Bottom", ImGuiWindowFlags_NoBringToFrontOnFocus));
+        ImGui::Render();
+        IM_ASSERT(g.NavWindow && strcmp(g.NavWindow->Name, "Bottom") == 0);
+    }
+
+    // Ctrl+Tab: the window targeted by the windowing list is displayed on top of everything
+    ImGui::SetWindowFocus("Top");
+    ImGui::SetWindowFocus(NULL);
+    io.KeyCtrl = true;
+    bool bottom_targeted = false;
+    for (int n = 0; n < 12; n++)
+    {
+        io.KeysDown[ImGuiKey_Tab] = (n % 2) == 0;
+        TestNewFrame();
+        IM_ASSERT(SubmitFullscreenWindow("Top"));
+        const bool bottom_visible = SubmitFullscreenWindow("Bottom", ImGuiWindowFlags_NoBringToFrontOnFocus);
+        ImGui::Render();
+        if (g.NavWindowingTarget && strcmp(g.NavWindowingTarget->Name, "Bottom") == 0)
+        {
+            IM_ASSERT(bottom_visible);
+            bottom_targeted = true;
+        }
+    }
+    IM_ASSERT(bottom_targeted);
+    io.KeyCtrl = io.KeysDown[ImGuiKey_Tab] = false;
+
+    // Popup opened from a window which then gets covered
+    TestNewFrame();
+    IM_ASSERT(ImGui::Begin("Bottom", NULL, ImGuiWindowFlags_NoBringToFrontOnFocus));
+    ImGui::OpenPopup("Popup");
+    ImGui::End();
+    ImGui::Render();
+    for (int n = 0; n < 3; n++)
+    {
+        TestNewFrame();
+        IM_ASSERT(SubmitFullscreenWindow("Top"));
+        IM_ASSERT(ImGui::Begin("Bottom", NULL, ImGuiWindowFlags_NoBringToFrontOnFocus));
+        IM_ASSERT(ImGui::BeginPopup("Popup"));
+        ImGui::Text("Popup");
+        ImGui::EndPopup();
+        ImGui::End();
+        ImGui::Render();
+    }
+
+    ImGui::DestroyContext();
+    printf("Occlusion culling tests passed\n");
+}
+
+static bool ComboTest_ItemGetter(void* data, int idx, const char** out_text)
+{
+    static char buf[64];
+    snprintf(buf, IM_ARRAYSIZE(buf), (idx % 50 == 0) ? "Item %d, with a name longer than the combo is wide" : "Item %d", idx);
+    *out_text = buf;
+    IM_UNUSED(data);
+    return true;
+}
+
+// Open a combo and scroll through its items: the width of the popup should never change
+static void TestComboPopupWidth(int items_count, float expected_width)
+{
+    CreateTestContext();
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    int current_item = 0;
+    float popup_width = -1.0f;
+    for (int n = 0; n < 50; n++)
+    {
+        TestNewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(400, 400));
+        ImGui::Begin("Combo");
+        ImGui::SetNextItemWidth(200.0f);
+        if (n == 0)
+            ImGui::OpenPopupEx(ImGui::GetID("combo"));
+        ImGui::Combo("combo", &current_item, ComboTest_ItemGetter, NULL, items_count);
+        ImGui::End();
+        ImGui::Render();
+
+        ImGuiWindow* popup_window = ImGui::FindWindowByName("##Combo_00");
+        IM_ASSERT(popup_window != NULL && popup_window->Active);
+        if (n >= 2) // Auto-fitting takes 2 frames
+        {
+            IM_ASSERT(popup_width < 0.0f || popup_window->Size.x == popup_width);
+            popup_width = popup_window->Size.x;
+        }
+        ImGui::SetScrollY(popup_window, popup_window->Scroll.y + 33.0f);
+    }
+    IM_ASSERT(expected_width < 0.0f || popup_width == expected_width);
+    IM_ASSERT(g.OpenPopupStack.Size == 1);
+    ImGui::DestroyContext();
+}
+
+static void RunComboTests()
+{
+    TestComboPopupWidth(500, -1.0f);        // All items submitted: auto-fit to the widest item
+    TestComboPopupWidth(1000000, 200.0f);   // Items clipped: as wide as the combo
+    printf("Combo tests passed\n");
+}
+
+// Submit a list of 10 items 100 pixels wide with an ImGuiSelection, the mouse being at 'mouse_pos'. Return the position of the first item.
+static ImVec2 SubmitSelectionListFrame(ImGuiSelection* selection, ImVec2 mouse_pos, bool mouse_down)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.MousePos = mouse_pos;
+    io.MouseDown[0] = mouse_down;
+    TestNewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(400, 400));
+    ImGui::Begin("List", NULL, ImGuiWindowFlags_NoTitleBar);
+    const ImVec2 list_pos = ImGui::GetCursorScreenPos();
+    ImGuiListClipper clipper;
+    clipper.Begin(10, ImGui::GetTextLineHeightWithSpacing());
+    selection->Update(&clipper);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            char label[32];
+            snprintf(label, IM_ARRAYSIZE(label), "Item %d", n);
+            ImGui::Selectable(label, selection, n, 0, ImVec2(100, 0));
+        }
+    ImGui::End();
+    ImGui::Render();
+    return list_pos;
+}
+
+// Press the mouse at 'pos0', drag it to 'pos1' over a few frames and release it
+static void DragSelectionList(ImGuiSelection* selection, ImVec2 pos0, ImVec2 pos1)
+{
+    SubmitSelectionListFrame(selection, pos0, true);
+    for (int n = 1; n <= 4; n++)
+        SubmitSelectionListFrame(selection, ImLerp(pos0, pos1, n / 4.0f), true);
+    SubmitSelectionListFrame(selection, pos1, false);
+}
+
+// Check that box-select only starts from a click in the list, past the drag threshold, and only selects the items crossed by the box
+static void RunSelectionTests()
+{
+    CreateTestContext();
+    ImGuiSelection selection;
+    const ImVec2 list_pos = SubmitSelectionListFrame(&selection, ImVec2(-1, -1), false);
+    SubmitSelectionListFrame(&selection, ImVec2(-1, -1), false);
+    const float item_height = ImGui::GetTextLineHeightWithSpacing();
+    const float empty_x = list_pos.x + 200.0f;  // On the right of the items
+    const float item_x = list_pos.x + 50.0f;
+
+    // Click in the empty space of the list without dragging: nothing is selected
+    DragSelectionList(&selection, ImVec2(empty_x, list_pos.y + item_height * 1.5f), ImVec2(empty_x + 1.0f, list_pos.y + item_height * 1.5f));
+    IM_ASSERT(selection.Count == 0);
+
+    // Drag on the right of the items, without crossing them: nothing is selected
+    DragSelectionList(&selection, ImVec2(empty_x, list_pos.y + item_height * 1.5f), ImVec2(empty_x - 50.0f, list_pos.y + item_height * 4.5f));
+    IM_ASSERT(selection.Count == 0);
+
+    // Drag from the empty space over items 1 to 4: they are selected
+    DragSelectionList(&selection, ImVec2(empty_x, list_pos.y + item_height * 1.5f), ImVec2(item_x, list_pos.y + item_height * 4.5f));
+    IM_ASSERT(selection.Count == 4 && selection.Contains(1) && selection.Contains(4));
+
+    // Drag from below the list: it doesn't start a box-select
+    DragSelectionList(&selection, ImVec2(empty_x, list_pos.y + item_height * 12.0f), ImVec2(item_x, list_pos.y + item_height * 0.5f));
+    IM_ASSERT(selection.Count == 4 && !selection.BoxSelectActive);
+
+    ImGui::DestroyContext();
+    printf("Selection tests passed\n");
+}
+
+// Check ImGuiSelection against an array of bools under random SetRange(), clicks, SelectAll() and Clear()
+static void RunSelectionRangesTests()
+{
+    const int items_count = 2000;
+    ImGuiSelection selection;
+    ImVector<bool> selected;
+    selected.resize(items_count, false);
+    int anchor_idx = -1;
+    unsigned int seed = 1;
+    for (int iter = 0; iter < 20000; iter++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int op = (int)((seed >> 8) % 100);
+        const int a = (int)((seed >> 12) % items_count);
+        seed = seed * 1664525u + 1013904223u;
+        const int b = (op < 80) ? ImMin(a + (int)((seed >> 8) % 100), items_count) : (int)((seed >> 8) % items_count);
+        const bool sel = ((seed >> 24) & 1) != 0, ctrl = ((seed >> 25) & 1) != 0, shift = ((seed >> 26) & 1) != 0;
+        if (op < 85)
+        {
+            selection.SetRange(ImMin(a, b), ImMax(a, b), sel);
+            for (int n = ImMin(a, b); n < ImMax(a, b); n++)
+                selected[n] = sel;
+        }
+        else if (op < 98)
+        {
+            selection.ApplyClick(a, ctrl, shift);
+            if (shift && anchor_idx != -1)
+            {
+                for (int n = 0; n < items_count; n++)
+                    if (n >= ImMin(anchor_idx, a) && n <= ImMax(anchor_idx, a))
+                        selected[n] = true;
+                    else if (!ctrl)
+                        selected[n] = false;
+            }
+            else
+            {
+                const bool new_state = ctrl ? !selected[a] : true;
+                if (!ctrl)
+                    for (int n = 0; n < items_count; n++)
+                        selected[n] = false;
+                selected[a] = new_state;
+                anchor_idx = a;
+            }
+        }
+        else if (op == 98)
+        {
+            selection.SelectAll(items_count);
+            for (int n = 0; n < items_count; n++)
+                selected[n] = true;
+        }
+        else
+        {
+            selection.Clear();
+            for (int n = 0; n < items_count; n++)
+                selected[n] = false;
+        }
+
+        // Ranges are sorted, not empty, not overlapping nor adjacent, and match the bools
+        int count = 0;
+        for (int n = 0; n < selection.Ranges.Size; n++)
+        {
+            IM_ASSERT(selection.Ranges[n].Begin < selection.Ranges[n].End);
+            IM_ASSERT(n == 0 || selection.Ranges[n - 1].End < selection.Ranges[n].Begin);
+            count += selection.Ranges[n].End - selection.Ranges[n].Begin;
+        }
+        IM_ASSERT(count == selection.Count && selection.AnchorIdx == anchor_idx);
+        for (int n = 0; n < items_count; n++)
+        {
+            IM_ASSERT(selection.Contains(n) == selected[n] && "ImGuiSelection should match an array of bools");
+            count -= selected[n] ? 1 : 0;
+        }
+        IM_ASSERT(count == 0);
+    }
+    printf("Selection ranges tests passed\n");
+}
+
+// Plot 1M values which are all 0.0f except for a single spike, and return the top of the plotted geometry relative to the plot
+// frame (0.0f: top, 1.0f: bottom)
+static float PlotSpikeTop(const float* values, int values_count, bool histogram, bool fixed_scale)
+{
+    TestNewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("Plots");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const int vtx_begin = draw_list->VtxBuffer.Size;
+    const float scale_min = fixed_scale ? -1.0f : FLT_MAX;
+    const float scale_max = fixed_scale ? 1.0f : FLT_MAX;
+    if (histogram)
+        ImGui::PlotHistogram("##values", values, values_count, 0, NULL, scale_min, scale_max, ImVec2(500, 100));
+    else
+        ImGui::PlotLines("##values", values, values_count, 0, NULL, scale_min, scale_max, ImVec2(500, 100));
+    const ImRect frame_bb(ImGui::GetItemRectMin(), ImGui::GetItemRectMax());
+    const ImU32 col = ImGui::GetColorU32(histogram ? ImGuiCol_PlotHistogram : ImGuiCol_PlotLines);
+    float y_min = FLT_MAX;
+    for (int n = vtx_begin; n < draw_list->VtxBuffer.Size; n++)
+        if (draw_list->VtxBuffer[n].col == col && draw_list->VtxBuffer[n].pos.y < y_min)
+            y_min = draw_list->VtxBuffer[n].pos.y;
+    ImGui::End();
+    ImGui::EndFrame();
+    return (y_min - frame_bb.Min.y) / frame_bb.GetHeight();
+}
+
+// Check that a single value spike in 1M values is drawn, whether the scale is automatic or fixed
+static void RunPlotTests()
+{
+    CreateTestContext();
+    ImVector<float> values;
+    values.resize(1000000);
+    memset(values.Data, 0, (size_t)values.size_in_bytes());
+    values[123457] = 1.0f;
+    for (int mode = 0; mode < 4; mode++)
+    {
+        const bool histogram = (mode & 1) != 0, fixed_scale = (mode & 2) != 0;
+        IM_ASSERT(PlotSpikeTop(values.Data, values.Size, histogram, fixed_scale) < 0.1f && "The spike should reach the top of the plot");
+    }
+    ImGui::DestroyContext();
+    printf("Plot tests passed\n");
+}
+
+static void PlotStreamBruteForceMinMax(const ImGuiPlotStream* stream, float* out_min, float* out_max)
+{
+    *out_min = FLT_MAX;
+    *out_max = -FLT_MAX;
+    for (int n = 0; n < stream->GetSize(); n++)
+    {
+        const float v = stream->Values[n];
+        *out_min = (v < *out_min) ? v : *out_min;
+        *out_max = (v > *out_max) ? v : *out_max;
+    }
+}
+
+// Plot 'stream' and return the draw list vertices of the plot, relative to its frame
+static void PlotStreamVertices(const char* label, ImGuiPlotStream* stream, bool histogram, ImVector<ImVec2>* out_pos)
+{
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const int vtx_begin = draw_list->VtxBuffer.Size;
+    if (histogram)
+        ImGui::PlotHistogram(label, stream, NULL, FLT_MAX, FLT_MAX, ImVec2(300, 50));
+    else
+        ImGui::PlotLines(label, stream, NULL, FLT_MAX, FLT_MAX, ImVec2(300, 50));
+    const ImVec2 frame_min = ImGui::GetItemRectMin();
+    out_pos->resize(0);
+    for (int n = vtx_begin; n < draw_list->VtxBuffer.Size; n++)
+        out_pos->push_back(ImVec2(draw_list->VtxBuffer[n].pos.x - frame_min.x, draw_list->VtxBuffer[n].pos.y - frame_min.y));
+}
+
+// Add batches of random values (with ties and NaN) to a stream and check its min/max, levels of detail and cached pixel columns against
+// brute force and against a copy of the stream plotted without cached columns
+static void RunPlotStreamTests()
+{
+    CreateTestContext();
+    ImGuiPlotStream stream(1000);
+    ImVector<float> batch;
+    ImVector<ImVec2> vtx_cached, vtx_fresh;
+    unsigned int seed = 1;
+    int walk = 0;
+    for (int iter = 0; iter < 400; iter++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int batch_size = (iter % 50 == 49) ? 1500 : (int)((seed >> 8) % 200);
+        batch.resize(batch_size);
+        for (int n = 0; n < batch_size; n++)
+        {
+            // Random walk, so that the min/max scroll out of the buffer
+            seed = seed * 1664525u + 1013904223u;
+            const int r = (int)((seed >> 8) % 64);
+            walk += (r % 7) - 3;
+            batch[n] = (r == 0) ? sqrtf(-1.0f) : (float)walk;
+        }
+        stream.AddValues(batch.Data, batch.Size);
+
+        float v_min, v_max;
+        PlotStreamBruteForceMinMax(&stream, &v_min, &v_max);
+        IM_ASSERT(stream.GetMin() == v_min && stream.GetMax() == v_max && "Stream min/max should match brute force");
+
+        seed = seed * 1664525u + 1013904223u;
+        const int idx_begin = (int)((seed >> 8) % stream.GetCapacity());
+        const int idx_end = idx_begin + (int)((seed >> 20) % (stream.GetCapacity() - idx_begin)) + 1;
+        float cache_min, cache_max, range_min = FLT_MAX, range_max = -FLT_MAX;
+        stream.Cache.GetMinMax(idx_begin, idx_end, &cache_min, &cache_max);
+        for (int n = idx_begin; n < idx_end; n++)
+        {
+            range_min = (stream.Values[n] < range_min) ? stream.Values[n] : range_min;
+            range_max = (stream.Values[n] > range_max) ? stream.Values[n] : range_max;
+        }
+        IM_ASSERT(cache_min == range_min && cache_max == range_max && "Stream levels of detail should match brute force");
+
+        if (stream.GetSize() < 300)
+            continue;
+        TestNewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+        ImGui::Begin("Stream");
+        const bool histogram = (iter >= 200); // Changing the plot type changes the number of columns, which resets the cached columns
+        PlotStreamVertices("##cached", &stream, histogram, &vtx_cached);
+        ImGuiPlotStream stream_fresh = stream;
+        stream_fresh.ColumnsIdx.clear();
+        PlotStreamVertices("##fresh", &stream_fresh, histogram, &vtx_fresh);
+        IM_ASSERT(vtx_cached.Size > 0 && vtx_cached.Size == vtx_fresh.Size);
+        for (int n = 0; n < vtx_cached.Size; n++)
+            IM_ASSERT(ImFabs(vtx_cached[n].x - vtx_fresh[n].x) < 0.01f && ImFabs(vtx_cached[n].y - vtx_fresh[n].y) < 0.01f && "Cached columns should match a plot computed from scratch");
+        ImGui::End();
+        ImGui::EndFrame();
+    }
+    ImGui::DestroyContext();
+    printf("Plot stream tests passed\n");
+}
+
+// Check the offsets and the item lookup of ImGuiListClipperHeights against prefix sums, under random resizes and height changes.
+// Heights are small integers so that the sums are exact.
+static void RunListClipperHeightsTests()
+{
+    ImGuiListClipperHeights heights;
+    heights.DefaultHeight = 17.0f;
+    ImVector<double> offsets; // offsets[n]: sum of the heights of items [0, n)
+    unsigned int seed = 1;
+    for (int iter = 0; iter < 2000; iter++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int op = (int)((seed >> 8) % 16);
+        if (op == 0)
+            heights.Resize((int)((seed >> 12) % 3000));
+        else if (heights.Heights.Size > 0)
+            heights.SetHeight((int)((seed >> 12) % heights.Heights.Size), (float)(1 + (seed >> 24) % 50));
+
+        const int items_count = heights.Heights.Size;
+        offsets.resize(items_count + 1);
+        offsets[0] = 0.0;
+        for (int n = 0; n < items_count; n++)
+            offsets[n + 1] = offsets[n] + heights.GetHeight(n);
+        if (iter % 16 != 0)
+            continue;
+        for (int n = 0; n <= items_count; n++)
+            IM_ASSERT(heights.GetOffset(n) == (float)offsets[n] && "GetOffset() should match brute force");
+        for (int n = 0; n < items_count; n++)
+        {
+            // Each item starts at its offset and covers the offsets up to the next one
+            IM_ASSERT(heights.FindItem((float)offsets[n]) == n && "FindItem() should match brute force");
+            IM_ASSERT(heights.FindItem((float)offsets[n + 1] - 0.5f) == n && "FindItem() should match brute force");
+        }
+        IM_ASSERT(heights.FindItem(-1.0f) == 0 && heights.FindItem((float)offsets[items_count] + 1.0f) == ImMax(items_count - 1, 0));
+    }
+    printf("List clipper heights tests passed\n");
+}
+
+// Append the visible descendants of a node (-1: the whole tree) to 'out', walking the tree recursively
+static void TreeViewBruteForceVisibleNodes(const ImGuiTreeView* tree, int node_idx, ImVector<int>* out)
+{
+    for (int n = (node_idx == -1) ? tree->FirstRoot : tree->Nodes[node_idx].FirstChild; n != -1; n = tree->Nodes[n].NextSibling)
+    {
+        out->push_back(n);
+        if (tree->Nodes[n].Open)
+            TreeViewBruteForceVisibleNodes(tree, n, out);
+    }
+}
+
+static bool TreeViewMatchesBruteForce(const ImGuiTreeView* tree, ImVector<int>* temp)
+{
+    temp->resize(0);
+    TreeViewBruteForceVisibleNodes(tree, -1, temp);
+    return temp->Size == tree->VisibleNodes.Size && memcmp(temp->Data, tree->VisibleNodes.Data, (size_t)temp->size_in_bytes()) == 0;
+}
+
+// Submit the rows of two trees with the same labels in the same window, the mouse being at 'mouse_pos'. Return the position of the
+// first row of the second tree.
+static ImVec2 SubmitTreeViewsFrame(ImGuiTreeView* trees, ImVec2 mouse_pos, bool mouse_down)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.MousePos = mouse_pos;
+    io.MouseDown[0] = mouse_down;
+    TestNewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(400, 400));
+    ImGui::Begin("Trees", NULL, ImGuiWindowFlags_NoTitleBar);
+    ImVec2 tree_pos;
+    for (int tree_n = 0; tree_n < 2; tree_n++)
+    {
+        ImGuiTreeView* tree = &trees[tree_n];
+        tree->Update();
+        tree_pos = ImGui::GetCursorScreenPos();
+        ImGuiListClipper clipper;
+        clipper.Begin(tree->VisibleNodes.Size);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                ImGui::TreeViewNode(tree, row, "Node");
+    }
+    ImGui::End();
+    ImGui::Render();
+    return tree_pos;
+}
+
+// Check that clicking a node of a tree view doesn't affect another tree view of the same window, and that updating the visible nodes
+// incrementally when opening/closing nodes gives the same rows as walking the whole tree, under random changes
+static void RunTreeViewTests()
+{
+    CreateTestContext();
+    ImGuiTreeView trees[2];
+    for (int tree_n = 0; tree_n < 2; tree_n++)
+        for (int n = 0; n < 3; n++)
+            trees[tree_n].AddNode(trees[tree_n].AddNode(-1));
+    const ImVec2 tree_pos = SubmitTreeViewsFrame(trees, ImVec2(-1, -1), false);
+    const ImVec2 click_pos(tree_pos.x + 30.0f, tree_pos.y + ImGui::GetFrameHeight() * 0.5f);
+    SubmitTreeViewsFrame(trees, click_pos, false);
+    SubmitTreeViewsFrame(trees, click_pos, true);
+    SubmitTreeViewsFrame(trees, click_pos, false);
+    SubmitTreeViewsFrame(trees, ImVec2(-1, -1), false);
+    IM_ASSERT(trees[1].Nodes[0].Open && trees[1].VisibleNodes.Size == 4 && "Clicking the first node of the second tree should open it");
+    IM_ASSERT(!trees[0].Nodes[0].Open && trees[0].VisibleNodes.Size == 3 && "Nodes of another tree should not be affected");
+
+    ImGuiTreeView tree;
+    ImVector<int> temp;
+    unsigned int seed = 1;
+    for (int n = 0; n < 3000; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        tree.AddNode((n < 10 || (seed >> 8) % 20 == 0) ? -1 : (int)((seed >> 12) % n), ((seed >> 24) & 1) != 0);
+    }
+    tree.Update();
+    IM_ASSERT(TreeViewMatchesBruteForce(&tree, &temp));
+    for (int iter = 0; iter < 2000; iter++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int op = (int)((seed >> 8) % 64);
+        if (op == 0)
+            tree.AddNode((int)((seed >> 12) % tree.Nodes.Size), ((seed >> 24) & 1) != 0);
+        else if (op == 1)
+            tree.SetAllNodesOpen(((seed >> 24) & 1) != 0);
+        else
+            tree.SetNodeOpen((int)((seed >> 12) % tree.Nodes.Size), ((seed >> 24) & 1) != 0);
+        tree.Update();
+        IM_ASSERT(TreeViewMatchesBruteForce(&tree, &temp) && "Visible nodes updated incrementally should match a full walk of the tree");
+    }
+    ImGui::DestroyContext();
+    printf("Tree view tests passed\n");
+}
+
+#ifdef IMGUI_EXAMPLE_NULL_BENCHMARKS
+// Each benchmark reports the average time of the measured section.
+static double GetTimeInSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// Submit 1000 child windows per frame, as e.g. a list of panels or a property grid would
+static void RunChildWindowsBenchmark(int frames_count)
+{
+    CreateTestContext();
+    const int children_count = 1000;
+    double t_frames = 0.0, t_best_frame = 1e9;
+    for (int n = 0; n < frames_count + 10; n++)
+    {
+        const double t0 = GetTimeInSeconds();
+        TestNewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(800, 600));
+        ImGui::Begin("Children");
+        for (int child_n = 0; child_n < children_count; child_n++)
+        {
+            ImGui::PushID(child_n);
+            ImGui::BeginChild("child", ImVec2(0, 20), true);
+            ImGui::EndChild();
+            ImGui::PopID();
+        }
+        ImGui::End();
+        ImGui::Render();
+        const double t_frame = GetTimeInSeconds() - t0;
+        if (n < 10) // Skip warm-up frames creating the windows
+            continue;
+        t_frames += t_frame;
+        t_best_frame = (t_frame < t_best_frame) ? t_frame : t_best_frame;
+    }
+    printf("Child windows: %d BeginChild() per frame, %.3f ms/frame (best %.3f ms)\n", children_count, t_frames * 1000.0 / frames_count, t_best_frame * 1000.0);
+    ImGui::DestroyContext();
+}
+
+// Submit a widget-heavy frame, then compare GetColorU32(ImGuiCol) with converting the style color on every call
+static void RunStyleColorsBenchmark(int frames_count)
+{
+    CreateTestContext();
+    float values[8] = {};
+    bool checks[8] = {};
+    double t_frames = 0.0, t_best_frame = 1e9;
+    for (int n = 0; n < frames_count + 10; n++)
+    {
+        const double t0 = GetTimeInSeconds();
+        TestNewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+        ImGui::Begin("Widgets");
+        for (int line_n = 0; line_n < 40; line_n++)
+        {
+            ImGui::PushID(line_n);
+            ImGui::Button("Button");
+            ImGui::SameLine();
+            ImGui::Checkbox("Check", &checks[line_n % 8]);
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(200.0f);
+            ImGui::SliderFloat("Slider", &values[line_n % 8], 0.0f, 1.0f);
+            ImGui::SameLine();
+            ImGui::ProgressBar(values[line_n % 8], ImVec2(200.0f, 0.0f));
+            ImGui::Separator();
+            ImGui::PopID();
+        }
+        ImGui::End();
+        ImGui::Render();
+        const double t_frame = GetTimeInSeconds() - t0;
+        if (n < 10)
+            continue;
+        t_frames += t_frame;
+        t_best_frame = (t_frame < t_best_frame) ? t_frame : t_best_frame;
+    }
+    printf("Style colors: widgets frame %.3f ms/frame (best %.3f ms)\n", t_frames * 1000.0 / frames_count, t_best_frame * 1000.0);
+
+    // The packed colors are only valid within a frame
+    TestNewFrame();
+    const ImGuiStyle& style = ImGui::GetStyle();
+    const int calls_count = 10000000;
+    ImU32 hash_cached = 0, hash_converted = 0;
+    const double t0 = GetTimeInSeconds();
+    for (int n = 0; n < calls_count; n++)
+        hash_cached = hash_cached * 31 + ImGui::GetColorU32(n % ImGuiCol_COUNT);
+    const double t1 = GetTimeInSeconds();
+    for (int n = 0; n < calls_count; n++)
+    {
+        ImVec4 col = style.Colors[n % ImGuiCol_COUNT];
+        col.w *= style.Alpha;
+        hash_converted = hash_converted * 31 + ImGui::ColorConvertFloat4ToU32(col);
+    }
+    const double t2 = GetTimeInSeconds();
+    IM_ASSERT(hash_cached == hash_converted);
+    ImGui::EndFrame();
+    printf("Style colors: GetColorU32() %.2f ns/call, ColorConvertFloat4ToU32() %.2f ns/call\n", (t1 - t0) * 1e9 / calls_count, (t2 - t1) * 1e9 / calls_count);
+    ImGui::DestroyContext();
+}
+
+// Submit 5000 small overlapping floating windows, measuring NewFrame() (which finds the hovered window by scanning the visible
+// windows from the compact g.WindowsHotData array) and the whole frame. With the mouse over the front-most window the scan stops
+// at the first entry, with the mouse over no window it tests all of them: the difference is the most a spatial index could save.
+static void RunManyWindowsBenchmark(int frames_count)
+{
+    const char* mode_names[] = { "mouse moving", "mouse over the front window", "mouse over no window" };
+    for (int mode = 0; mode < IM_ARRAYSIZE(mode_names); mode++)
+    {
+        CreateTestContext();
+        ImGuiIO& io = ImGui::GetIO();
+        const int windows_count = 5000;
+        double t_new_frames = 0.0, t_frames = 0.0;
+        for (int n = 0; n < frames_count + 10; n++)
+        {
+            // Windows are displayed in creation order, the last one is at the bottom right and windows don't go past x = 1822
+            if (mode == 0)
+                io.MousePos = ImVec2((float)((n * 37) % 1800), (float)((n * 23) % 1050));
+            else
+                io.MousePos = (mode == 1) ? ImVec2(1800.0f, 1050.0f) : ImVec2(1900.0f, 500.0f);
+            const double t0 = GetTimeInSeconds();
+            TestNewFrame();
+            const double t1 = GetTimeInSeconds();
+            for (int window_n = 0; window_n < windows_count; window_n++)
+            {
+                char window_name[32];
+                snprintf(window_name, IM_ARRAYSIZE(window_name), "Window %d", window_n);
+                ImGui::SetNextWindowPos(ImVec2((float)(window_n % 100) * 18.0f, (float)(window_n / 100) * 21.0f), ImGuiCond_FirstUseEver);
+                ImGui::SetNextWindowSize(ImVec2(40.0f, 40.0f), ImGuiCond_FirstUseEver);
+                ImGui::Begin(window_name, NULL, ImGuiWindowFlags_NoTitleBar);
+                ImGui::TextUnformatted("W");
+                ImGui::End();
+            }
+            ImGui::Render();
+            if (n < 10) // Skip warm-up frames creating the windows
+                continue;
+            t_new_frames += t1 - t0;
+            t_frames += GetTimeInSeconds() - t0;
+        }
+        IM_ASSERT((mode != 1 || ImGui::GetCurrentContext()->HoveredWindow == ImGui::FindWindowByName("Window 4999")) && (mode != 2 || ImGui::GetCurrentContext()->HoveredWindow == NULL));
+        printf("Many windows: %d windows, %-27s NewFrame() %.3f ms, %.3f ms/frame\n", windows_count, mode_names[mode], t_new_frames * 1000.0 / frames_count, t_frames * 1000.0 / frames_count);
+        ImGui::DestroyContext();
+    }
+}
+
+// Submit 8 stacked full-screen windows of 400 rows each, without occlusion culling, then with culling when submitting
+// the windows from the top-most one (Begin() skips covered windows) and from the bottom-most one (only rendering is skipped)
+static void RunOcclusionCullingBenchmark(int frames_count)
+{
+    const char* mode_names[] = { "culling disabled", "culling, top window first", "culling, bottom window first" };
+    for (int mode = 0; mode < IM_ARRAYSIZE(mode_names); mode++)
+    {
+        CreateTestContext();
+        ImGui::GetIO().ConfigWindowsOcclusionCulling = (mode != 0);
+        const int windows_count = 8;
+        double t_frames = 0.0;
+        for (int n = 0; n < frames_count + 10; n++)
+        {
+            const double t0 = GetTimeInSeconds();
+            TestNewFrame();
+            for (int window_n = 0; window_n < windows_count; window_n++)
+            {
+                // Windows are created bottom to top during the first frame
+                const int window_idx = (n == 0 || mode != 1) ? window_n : windows_count - 1 - window_n;
+                char window_name[32];
+                snprintf(window_name, IM_ARRAYSIZE(window_name), "Window %d", window_idx);
+                ImGui::SetNextWindowPos(ImVec2(0, 0));
+                ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+                ImGui::SetNextWindowBgAlpha(1.0f);
+                if (ImGui::Begin(window_name))
+                    for (int row_n = 0; row_n < 400; row_n++)
+                    {
+                        ImGui::PushID(row_n);
+                        ImGui::Text("Row %d", row_n);
+                        ImGui::SameLine();
+                        ImGui::Button("Button");
+                        ImGui::PopID();
+                    }
+                ImGui::End();
+            }
+            ImGui::Render();
+            if (n >= 10)
+                t_frames += GetTimeInSeconds() - t0;
+        }
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        printf("Occlusion culling: %-29s %.3f ms/frame, %d draw lists, %d vertices\n", mode_names[mode], t_frames * 1000.0 / frames_count, draw_data->CmdListsCount, draw_data->TotalVtxCount);
+        ImGui::DestroyContext();
+    }
+}
+
+// Plot 1M values with auto-scaling and with a fixed scale, from the array and from an ImGuiPlotCache
+static void RunPlotBenchmark(int frames_count)
+{
+    CreateTestContext();
+    ImVector<float> values;
+    values.resize(1000000);
+    for (int n = 0; n < values.Size; n++)
+        values[n] = sinf(n * 0.0001f) + ((n % 9973 == 0) ? 1.5f : 0.0f);
+    ImGuiPlotCache cache;
+    cache.Build(values.Data, values.Size);
+
+    const char* mode_names[] = { "array, auto-scale", "array, fixed scale", "cache, auto-scale", "cache, fixed scale" };
+    for (int mode = 0; mode < IM_ARRAYSIZE(mode_names); mode++)
+    {
+        const bool fixed_scale = (mode & 1) != 0;
+        const float scale_min = fixed_scale ? -1.0f : FLT_MAX;
+        const float scale_max = fixed_scale ? 2.5f : FLT_MAX;
+        double t_plots = 0.0;
+        for (int n = 0; n < frames_count + 10; n++)
+        {
+            TestNewFrame();
+            ImGui::SetNextWindowPos(ImVec2(0, 0));
+            ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+            ImGui::Begin("Plots");
+            const double t0 = GetTimeInSeconds();
+            if (mode < 2)
+                ImGui::PlotLines("values", values.Data, values.Size, 0, NULL, scale_min, scale_max, ImVec2(1000, 200));
+            else
+                ImGui::PlotLinesCached("values", &cache, 0, NULL, scale_min, scale_max, ImVec2(1000, 200));
+            if (n >= 10)
+                t_plots += GetTimeInSeconds() - t0;
+            ImGui::End();
+            ImGui::Render();
+        }
+        printf("Plot: %d values, %-18s %.1f us/plot\n", values.Size, mode_names[mode], t_plots * 1e6 / frames_count);
+    }
+    ImGui::DestroyContext();
+}
+
+// Scroll through a list of 1M items of variable height (1 or 3 lines), clipped with ImGuiListClipperHeights, and compare with a list of
+// items of known uniform height. Each frame scrolls to a new position, so most visible items are measured for the first time.
+static void RunListClipperHeightsBenchmark(int frames_count)
+{
+    const int items_count = 1000000;
+    const char* mode_names[] = { "uniform height", "variable height" };
+    for (int mode = 0; mode < IM_ARRAYSIZE(mode_names); mode++)
+    {
+        CreateTestContext();
+        ImGuiListClipperHeights heights;
+        int items_submitted = 0;
+        double t_list = 0.0;
+        for (int n = 0; n < frames_count + 10; n++)
+        {
+            TestNewFrame();
+            ImGui::SetNextWindowPos(ImVec2(0, 0));
+            ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+            ImGui::Begin("List");
+            const double t0 = GetTimeInSeconds();
+            ImGuiListClipper clipper;
+            if (mode == 0)
+                clipper.Begin(items_count, ImGui::GetTextLineHeightWithSpacing());
+            else
+                clipper.Begin(items_count, &heights);
+            while (clipper.Step())
+                for (int item_n = clipper.DisplayStart; item_n < clipper.DisplayEnd; item_n++)
+                {
+                    if (mode == 1 && (item_n % 7) == 0)
+                        ImGui::Text("%d The quick brown fox\n  jumps over\n  the lazy dog", item_n);
+                    else
+                        ImGui::Text("%d The quick brown fox jumps over the lazy dog", item_n);
+                    items_submitted += (n >= 10) ? 1 : 0;
+                }
+            if (n >= 10)
+                t_list += GetTimeInSeconds() - t0;
+            ImGui::SetScrollY(ImGui::GetScrollMaxY() * (float)((n * 7919) % 1000) / 1000.0f);
+            ImGui::End();
+            ImGui::Render();
+        }
+        printf("List clipper: %d items, %-15s %.1f us/frame, %d items submitted/frame\n", items_count, mode_names[mode], t_list * 1e6 / frames_count, items_submitted / frames_count);
+        ImGui::DestroyContext();
+    }
+}
+
+// Select all, Shift+Click a range and Ctrl+Click items of a 10M items list with ImGuiSelection, compared with an array of bools,
+// and display the list with the clipper, scrolling to a new position each frame.
+static void RunSelectionBenchmark(int frames_count)
+{
+    const int items_count = 10000000;
+    const int clicks_count = 10000;
+    ImGuiSelection selection;
+    ImVector<bool> selected;
+    selected.resize(items_count, false);
+
+    double t0 = GetTimeInSeconds();
+    selection.SelectAll(items_count);
+    const double t_select_all = GetTimeInSeconds() - t0;
+    t0 = GetTimeInSeconds();
+    for (int n = 0; n < items_count; n++)
+        selected[n] = true;
+    const double t_select_all_bools = GetTimeInSeconds() - t0;
+
+    selection.ApplyClick(10, false, false);
+    t0 = GetTimeInSeconds();
+    selection.ApplyClick(items_count - 10, false, true);
+    const double t_shift_click = GetTimeInSeconds() - t0;
+    t0 = GetTimeInSeconds();
+    for (int n = 0; n < items_count; n++)
+        selected[n] = (n >= 10 && n <= items_count - 10);
+    const double t_shift_click_bools = GetTimeInSeconds() - t0;
+
+    // Ctrl+Click scattered items, each splitting a range
+    unsigned int seed = 1;
+    t0 = GetTimeInSeconds();
+    for (int n = 0; n < clicks_count; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        selection.ApplyClick((int)(seed % items_count), true, false);
+    }
+    const double t_ctrl_click = (GetTimeInSeconds() - t0) / clicks_count;
+    seed = 1;
+    for (int n = 0; n < clicks_count; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        selected[(int)(seed % items_count)] = !selected[(int)(seed % items_count)];
+    }
+
+    t0 = GetTimeInSeconds();
+    int contained = 0;
+    for (int n = 0; n < items_count; n++)
+        contained += selection.Contains(n) ? 1 : 0;
+    const double t_contains = (GetTimeInSeconds() - t0) / items_count;
+    IM_ASSERT(contained == selection.Count);
+    for (int n = 0; n < items_count; n++)
+        IM_ASSERT(selection.Contains(n) == selected[n]);
+
+    CreateTestContext();
+    double t_frames = 0.0;
+    for (int n = 0; n < frames_count + 10; n++)
+    {
+        TestNewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+        ImGui::Begin("Selection");
+        const double t1 = GetTimeInSeconds();
+        ImGuiListClipper clipper;
+        clipper.Begin(items_count, ImGui::GetTextLineHeightWithSpacing());
+        selection.Update(&clipper);
+        while (clipper.Step())
+            for (int item_n = clipper.DisplayStart; item_n < clipper.DisplayEnd; item_n++)
+            {
+                char label[32];
+                ImFormatString(label, IM_ARRAYSIZE(label), "Item %d", item_n);
+                ImGui::Selectable(label, &selection, item_n);
+            }
+        if (n >= 10)
+            t_frames += GetTimeInSeconds() - t1;
+        ImGui::SetScrollY(ImGui::GetScrollMaxY() * (float)((n * 7919) % 1000) / 1000.0f);
+        ImGui::End();
+        ImGui::Render();
+    }
+    ImGui::DestroyContext();
+
+    printf("Selection: %d items: select all %.0f ns (bools %.2f ms), Shift+Click range %.0f ns (bools %.2f ms)\n",
+        items_count, t_select_all * 1e9, t_select_all_bools * 1e3, t_shift_click * 1e9, t_shift_click_bools * 1e3);
+    printf("Selection: %d Ctrl+Clicks %.2f us/click, %d ranges: Contains() %.1f ns, %.1f us/frame\n",
+        clicks_count, t_ctrl_click * 1e6, selection.Ranges.Size, t_contains * 1e9, t_frames * 1e6 / frames_count);
+}
+
+// A tree of 100 roots with 100 children with 100 children (1010100 nodes), displayed closed, with its roots open, and fully open.
+// Measures rebuilding the visible rows, a frame scrolling to a new position, and opening/closing a root incrementally.
+static void RunTreeViewBenchmark(int frames_count)
+{
+    ImGuiTreeView tree;
+    for (int n0 = 0; n0 < 100; n0++)
+    {
+        const int node0 = tree.AddNode(-1);
+        for (int n1 = 0; n1 < 100; n1++)
+        {
+            const int node1 = tree.AddNode(node0);
+            for (int n2 = 0; n2 < 100; n2++)
+                tree.AddNode(node1);
+        }
+    }
+
+    const char* mode_names[] = { "closed", "roots open", "all open" };
+    ImVector<int> temp;
+    for (int mode = 0; mode < IM_ARRAYSIZE(mode_names); mode++)
+    {
+        CreateTestContext();
+        tree.SetAllNodesOpen(mode == 2);
+        if (mode == 1)
+            for (int node_idx = tree.FirstRoot; node_idx != -1; node_idx = tree.Nodes[node_idx].NextSibling)
+                tree.Nodes[node_idx].Open = true;
+        TestNewFrame();
+        const double t0 = GetTimeInSeconds();
+        tree.Update();
+        const double t_rebuild = GetTimeInSeconds() - t0;
+        ImGui::EndFrame();
+
+        double t_frames = 0.0;
+        for (int n = 0; n < frames_count + 10; n++)
+        {
+            TestNewFrame();
+            ImGui::SetNextWindowPos(ImVec2(0, 0));
+            ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+            ImGui::Begin("Tree");
+            const double t1 = GetTimeInSeconds();
+            tree.Update();
+            ImGuiListClipper clipper;
+            clipper.Begin(tree.VisibleNodes.Size);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                    ImGui::TreeViewNode(&tree, row, "Node");
+            if (n >= 10)
+                t_frames += GetTimeInSeconds() - t1;
+            ImGui::SetScrollY(ImGui::GetScrollMaxY() * (float)((n * 7919) % 1000) / 1000.0f);
+            ImGui::End();
+            ImGui::Render();
+        }
+
+        // Toggle each root twice, which inserts/removes its visible descendants and moves the rows below
+        TestNewFrame();
+        tree.Update();
+        const double t2 = GetTimeInSeconds();
+        for (int node_idx = tree.FirstRoot; node_idx != -1; node_idx = tree.Nodes[node_idx].NextSibling)
+        {
+            tree.SetNodeOpen(node_idx, !tree.Nodes[node_idx].Open);
+            tree.SetNodeOpen(node_idx, !tree.Nodes[node_idx].Open);
+        }
+        const double t_toggle = (GetTimeInSeconds() - t2) / 200;
+        ImGui::EndFrame();
+        IM_ASSERT(TreeViewMatchesBruteForce(&tree, &temp));
+
+        printf("Tree view: %d nodes, %-10s %7d rows: rebuild %.2f ms, %.1f us/frame, open/close a root %.1f us\n",
+            tree.Nodes.Size, mode_names[mode], tree.VisibleNodes.Size, t_rebuild * 1e3, t_frames * 1e6 / frames_count, t_toggle * 1e6);
+        ImGui::DestroyContext();
+    }
+}
+
+// 100 channels sampled at 10 kHz, each keeping 1 second of values, with the values of a 60 Hz frame added to every channel before plotting
+static void RunPlotStreamBenchmark(int frames_count)
+{
+    CreateTestContext();
+    const int channels_count = 100;
+    const int sample_rate = 10000;
+    const int values_per_frame = sample_rate / 60;
+    ImGuiPlotStream streams[channels_count];
+    for (int channel_n = 0; channel_n < channels_count; channel_n++)
+        streams[channel_n].SetCapacity(sample_rate);
+    ImVector<float> values;
+    values.resize(values_per_frame);
+
+    ImS64 sample_n = 0;
+    double t_add = 0.0, t_plots = 0.0;
+    for (int n = 0; n < frames_count + 10 + sample_rate / values_per_frame; n++)
+    {
+        const bool measure = (n >= 10 + sample_rate / values_per_frame); // Once the buffers are full
+        const double t0 = GetTimeInSeconds();
+        for (int channel_n = 0; channel_n < channels_count; channel_n++)
+        {
+            for (int value_n = 0; value_n < values_per_frame; value_n++)
+                values[value_n] = sinf((float)(sample_n + value_n) * (0.001f + channel_n * 0.0001f)) + (((sample_n + value_n) % 4999 == 0) ? 1.0f : 0.0f);
+            streams[channel_n].AddValues(values.Data, values.Size);
+        }
+        sample_n += values_per_frame;
+
+        // 20 channels per window, as the columns of 100 plots would overflow the 16-bit indices of a single draw list
+        TestNewFrame();
+        const double t1 = GetTimeInSeconds();
+        for (int channel_n = 0; channel_n < channels_count; channel_n++)
+        {
+            if (channel_n % 20 == 0)
+            {
+                char window_name[32];
+                ImFormatString(window_name, IM_ARRAYSIZE(window_name), "Channels %d-%d", channel_n, channel_n + 19);
+                ImGui::SetNextWindowPos(ImVec2((channel_n / 20) * 330.0f, 0.0f));
+                ImGui::SetNextWindowSize(ImVec2(330, 1080));
+                ImGui::Begin(window_name);
+            }
+            ImGui::PushID(channel_n);
+            ImGui::PlotLines("##channel", &streams[channel_n], NULL, FLT_MAX, FLT_MAX, ImVec2(300, 24));
+            ImGui::PopID();
+            if (channel_n % 20 == 19)
+                ImGui::End();
+        }
+        const double t2 = GetTimeInSeconds();
+        ImGui::Render();
+        if (measure)
+        {
+            t_add += t1 - t0;
+            t_plots += t2 - t1;
+        }
+    }
+
+    for (int channel_n = 0; channel_n < channels_count; channel_n++)
+    {
+        float v_min, v_max;
+        PlotStreamBruteForceMinMax(&streams[channel_n], &v_min, &v_max);
+        IM_ASSERT(streams[channel_n].GetMin() == v_min && streams[channel_n].GetMax() == v_max);
+    }
+    printf("Plot stream: %d channels at %d Hz, %d values/frame: AddValues() %.1f us/frame, plotting %.1f us/frame\n", channels_count, sample_rate, values_per_frame, t_add * 1e6 / frames_count, t_plots * 1e6 / frames_count);
+    ImGui::DestroyContext();
+}
+
+// Compare ImFormatString() with snprintf() on the formats used by numeric widgets, and check that the output is identical
+static void RunFormatBenchmark()
+{
+    const int values_count = 1000000;
+    ImVector<int> values_int;
+    ImVector<double> values_double;
+    values_int.resize(values_count);
+    values_double.resize(values_count);
+    unsigned int seed = 1;
+    for (int n = 0; n < values_count; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        values_int[n] = (int)seed;
+        values_double[n] = (double)(int)seed / 1000.0;
+    }
+
+    const char* int_formats[] = { "%d", "%08X", "Count: %u items" };
+    const char* float_formats[] = { "%.3f", "%.0f", "%g", "Value: %.2f%%" };
+    char buf_imgui[64], buf_crt[64];
+    for (int format_n = 0; format_n < IM_ARRAYSIZE(int_formats) + IM_ARRAYSIZE(float_formats); format_n++)
+    {
+        const bool is_int = format_n < IM_ARRAYSIZE(int_formats);
+        const char* format = is_int ? int_formats[format_n] : float_formats[format_n - IM_ARRAYSIZE(int_formats)];
+        for (int n = 0; n < values_count; n++)
+        {
+            const int len_imgui = is_int ? ImFormatString(buf_imgui, IM_ARRAYSIZE(buf_imgui), format, values_int[n]) : ImFormatString(buf_imgui, IM_ARRAYSIZE(buf_imgui), format, values_double[n]);
+            const int len_crt = is_int ? snprintf(buf_crt, IM_ARRAYSIZE(buf_crt), format, values_int[n]) : snprintf(buf_crt, IM_ARRAYSIZE(buf_crt), format, values_double[n]);
+            IM_ASSERT(len_imgui == len_crt && strcmp(buf_imgui, buf_crt) == 0 && "ImFormatString() output should match snprintf()");
+        }
+
+        int len_total = 0;
+        const double t0 = GetTimeInSeconds();
+        for (int n = 0; n < values_count; n++)
+            len_total += is_int ? ImFormatString(buf_imgui, IM_ARRAYSIZE(buf_imgui), format, values_int[n]) : ImFormatString(buf_imgui, IM_ARRAYSIZE(buf_imgui), format, values_double[n]);
+        const double t1 = GetTimeInSeconds();
+        for (int n = 0; n < values_count; n++)
+            len_total -= is_int ? snprintf(buf_crt, IM_ARRAYSIZE(buf_crt), format, values_int[n]) : snprintf(buf_crt, IM_ARRAYSIZE(buf_crt), format, values_double[n]);
+        const double t2 = GetTimeInSeconds();
+        IM_ASSERT(len_total == 0);
+        printf("Format \"%s\": ImFormatString() %.1f ns/call, snprintf() %.1f ns/call\n", format, (t1 - t0) * 1e9 / values_count, (t2 - t1) * 1e9 / values_count);
+    }
+}
+#endif
 
 int main(int, char**)
 {
     IMGUI_CHECKVERSION();
+    RunNumberParsingTests();
+    RunOcclusionCullingTests();
+    RunComboTests();
+    RunSelectionTests();
+    RunSelectionRangesTests();
+    RunPlotTests();
+    RunPlotStreamTests();
+    RunListClipperHeightsTests();
+    RunTreeViewTests();
+
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
 
+    // Verify that the UI below reaches a steady state without heap allocations once warmed up
+    io.ConfigDebugNoAllocAfterFrames = 10;
+
     // Build atlas
     unsigned char* tex_pixels = NULL;
     int tex_w, tex_h;
@@ -33,5 +1989,47 @@ int main(int, char**)
 
     printf("DestroyContext()\n");
     ImGui::DestroyContext();
+
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    int threads_count = (int)std::thread::hardware_concurrency();
+    threads_count = (threads_count < 2) ? 2 : (threads_count > 16) ? 16 : threads_count;
+    RunContextsOnThreads(threads_count, 1000);
+
+    unsigned int hash_serial = 0, hash_threads = 0;
+    RunJobWindows(0, 200, &hash_serial);
+    for (int n = 1; n <= threads_count; n *= 2)
+    {
+        RunJobWindows(n, 200, &hash_threads);
+        IM_ASSERT(hash_threads == hash_serial && "Job windows output should not depend on the number of threads!");
+    }
+
+    for (int n = 1; n <= 16; n *= 2)
+        RunDrawListProducers(n, 200);
+
+    RunAsyncListTests();
+    for (int n = 0; n <= 4; n = (n == 0) ? 1 : n * 4)
+        RunAsyncList(n, 150);
+
+    for (int n = 1; n <= 4; n *= 2)
+        RunLogConsole(n, 150);
+
+#ifndef _WIN32
+    RunTextViewerTests();
+    RunTextViewer(150);
+#endif
+#endif
+
+#ifdef IMGUI_EXAMPLE_NULL_BENCHMARKS
+    RunChildWindowsBenchmark(200);
+    RunStyleColorsBenchmark(200);
+    RunManyWindowsBenchmark(100);
+    RunFormatBenchmark();
+    RunOcclusionCullingBenchmark(200);
+    RunPlotBenchmark(200);
+    RunPlotStreamBenchmark(200);
+    RunListClipperHeightsBenchmark(200);
+    RunSelectionBenchmark(200);
+    RunTreeViewBenchmark(200);
+#endif
     return 0;
 }
@@ -62,6 +62,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
+// [SECTION] ImFrameArena
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -736,6 +737,7 @@ CODE
 
 // System includes
 #include <ctype.h>      // toupper
+#include <locale.h>     // localeconv
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
@@ -822,6 +824,7 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS = 4.0f;     // Extend outside and inside windows. Affect FindHoveredWindow().
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
+static const int   WINDOWS_POOL_BLOCK_SIZE                  = 16;       // Number of ImGuiWindow instances allocated at once.
 
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
@@ -829,6 +832,9 @@ static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock
 
 static void             SetCurrentWindow(ImGuiWindow* window);
 static void             FindHoveredWindow();
+static void             UpdateWindowsHotData();
+static void             UpdateWindowsOcclusion();
+static bool             IsWindowOccluded(ImGuiWindow* window);
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
@@ -882,6 +888,7 @@ static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVe
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
 static void             RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, const char* name, bool* p_open);
+static bool             BeginWindowEx(ImGuiWindow* window, bool window_just_created, const char* name, bool* p_open, ImGuiWindowFlags flags);
 
 }
 
@@ -896,7 +903,11 @@ static void             RenderWindowTitleBarContents(ImGuiWindow* window, const
 //    In your debugger, add GImGui to your watch window and notice how its value changes depending on which location you are currently stepping into.
 // 2) Important: Dear ImGui functions are not thread-safe because of this pointer.
 //    If you want thread-safety to allow N threads to access N different contexts, you can:
-//    - Change this variable to use thread local storage so each thread can refer to a different context, in imconfig.h:
+//    - '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in imconfig.h to store this variable in thread local storage, so each thread refers to its own context.
+//      Each thread then needs to call CreateContext() or SetCurrentContext() before using a context. Accessing a TLS variable has a small cost, and
+//      MSVC doesn't allow exporting a thread local variable from a DLL. Contexts may share a font atlas, see "Sharing a font atlas" comments in imgui.h.
+//      Note that other global state (allocator functions set with SetAllocatorFunctions()) stays shared, and imgui_demo.cpp uses static variables.
+//    - Or change this variable to use your own thread local storage, in imconfig.h:
 //          struct ImGuiContext;
 //          extern thread_local ImGuiContext* MyImGuiTLS;
 //          #define GImGui MyImGuiTLS
@@ -904,8 +915,12 @@ static void             RenderWindowTitleBarContents(ImGuiWindow* window, const
 //    - Future development aim to make this context pointer explicit to all calls. Also read https://github.com/ocornut/imgui/issues/586
 //    - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from different namespace.
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+IM_THREAD_LOCAL ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // If you use DLL hotreloading you might need to call SetAllocatorFunctions() after reloading code from this file.
@@ -1037,7 +1052,10 @@ ImGuiIO::ImGuiIO()
     ConfigInputTextCursorBlink = true;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
+    ConfigWindowsOcclusionCulling = false;
     ConfigWindowsMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
+    ConfigDebugNoAllocAfterFrames = -1;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1371,9 +1389,243 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
+// Fast path for the format strings typically used by numeric widgets (DataTypeFormatString(), ProgressBar() overlay, etc.):
+// a single "%d", "%i", "%u", "%x", "%X" (with 'll'/'I64' length modifier for 64-bit values), "%f", "%.Nf", "%g" or "%.Ng" conversion,
+// with optional width and '0' flag, surrounded by optional literal text. Anything else goes to vsnprintf().
+// Output is identical to vsnprintf(): we give up and use vsnprintf() whenever a floating-point value is too close to a rounding
+// tie to be decided exactly with double precision arithmetic, when the value is too large, and when the locale decimal point isn't '.'.
+#ifndef IMGUI_USE_STB_SPRINTF
+struct ImFormatSimpleSpec
+{
+    const char* Prefix;         // Literal text before the conversion (may contain "%%")
+    const char* PrefixEnd;
+    const char* Suffix;         // Literal text after the conversion (may contain "%%"), zero-terminated
+    char        Type;           // 'd', 'u', 'x', 'X', 'f', 'g'
+    bool        Is64;           // 'll' or 'I64' length modifier
+    bool        ZeroPad;
+    int         Width;
+    int         Precision;      // -1 when not specified
+};
+
+static const char* ImFormatSkipLiteral(const char* p)
+{
+    for (; *p; p++)
+        if (*p == '%')
+        {
+            if (p[1] != '%')
+                return p;
+            p++;
+        }
+    return p;
+}
+
+static bool ImFormatParseSimple(const char* fmt, ImFormatSimpleSpec* spec)
+{
+    const char* p = ImFormatSkipLiteral(fmt);
+    if (*p == 0)
+        return false;
+    spec->Prefix = fmt;
+    spec->PrefixEnd = p++;
+    spec->ZeroPad = (*p == '0');
+    if (spec->ZeroPad)
+        p++;
+    spec->Width = 0;
+    for (; *p >= '0' && *p <= '9' && spec->Width < 100; p++)
+        spec->Width = spec->Width * 10 + (*p - '0');
+    spec->Precision = -1;
+    if (*p == '.')
+        for (spec->Precision = 0, p++; *p >= '0' && *p <= '9' && spec->Precision < 100; p++)
+            spec->Precision = spec->Precision * 10 + (*p - '0');
+    spec->Is64 = false;
+    if (p[0] == 'l' && p[1] == 'l')
+        spec->Is64 = true, p += 2;
+    else if (p[0] == 'I' && p[1] == '6' && p[2] == '4')
+        spec->Is64 = true, p += 3;
+    switch (*p)
+    {
+    case 'd': case 'i': spec->Type = 'd'; break;
+    case 'u': case 'x': case 'X': spec->Type = *p; break;
+    case 'f': case 'F': case 'g': spec->Type = (char)(*p | 0x20); break;
+    default: return false;
+    }
+    if (spec->Width >= 64 || spec->Precision > 15 || ((spec->Type == 'f' || spec->Type == 'g') && spec->Is64) || (spec->Type != 'f' && spec->Type != 'g' && spec->Precision != -1))
+        return false;
+    spec->Suffix = ++p;
+    return *ImFormatSkipLiteral(p) == 0; // Only one conversion
+}
+
+// Write digits of 'v' backward, ending at 'p_end'. Return start of the written digits.
+static char* ImFormatWriteDigitsBackward(char* p_end, ImU64 v, int base, bool upper, int min_digits)
+{
+    const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char* p = p_end;
+    do { *--p = digits[v % (ImU64)base]; v /= (ImU64)base; min_digits--; } while (v != 0 || min_digits > 0);
+    return p;
+}
+
+// Compute round-to-nearest(v * 10^exp10) for v >= 0. Return false if the result cannot be guaranteed to match the correctly rounded value.
+static bool ImRoundScaledPow10(double v, int exp10, ImU64* out)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 }; // All exactly representable
+    if (exp10 < -22 || exp10 > 22)
+        return false;
+    const double r = (exp10 >= 0) ? v * pow10[exp10] : v / pow10[-exp10]; // Single rounding: error is at most 0.5 ulp
+    if (!(r < 4503599627370496.0)) // 2^52, also rejects NaN and infinities
+        return false;
+    const double r_floor = (double)(ImU64)r;
+    const double frac = r - r_floor;
+    const double tie_distance = (frac > 0.5) ? frac - 0.5 : 0.5 - frac;
+    if (tie_distance <= r * 4.5e-16) // Too close to a tie (including exact ties, which printf() implementations may round differently)
+        return false;
+    *out = (ImU64)r_floor + ((frac > 0.5) ? 1 : 0);
+    return true;
+}
+
+// Format a floating-point value for 'f'/'g' conversions into [out_end - N, out_end). Return start of output, or NULL if we need to fallback to vsnprintf().
+static char* ImFormatWriteFloatBackward(char* out_end, double v, const ImFormatSimpleSpec& spec)
+{
+    static const ImU64 pow10[] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL };
+    const char* decimal_point = localeconv()->decimal_point;
+    if (decimal_point[0] != '.' || decimal_point[1] != 0)
+        return NULL;
+
+    const double v_abs = (v < 0.0) ? -v : v;
+    ImU64 mantissa = 0;
+    int decimals = 0;
+    if (spec.Type == 'f')
+    {
+        decimals = (spec.Precision < 0) ? 6 : spec.Precision;
+        if (!ImRoundScaledPow10(v_abs, decimals, &mantissa))
+            return NULL;
+    }
+    else if (v_abs != 0.0)
+    {
+        // Only handle the cases where %g uses fixed notation (exponent output varies between C runtimes)
+        const int precision = (spec.Precision < 0) ? 6 : (spec.Precision == 0) ? 1 : spec.Precision;
+        const double log10_v = ImLog(v_abs) * 0.43429448190325182765; // Estimate, fixed below if off by one
+        int exp10 = (log10_v > -1000.0 && log10_v < 1000.0) ? (int)log10_v : 1000;
+        if (log10_v < 0.0 && (double)exp10 != log10_v)
+            exp10--;
+        for (int attempt = 0; ; attempt++)
+        {
+            if (attempt == 4 || exp10 < -5 || exp10 > precision)
+                return NULL;
+            if (!ImRoundScaledPow10(v_abs, precision - 1 - exp10, &mantissa))
+                return NULL;
+            if (mantissa >= pow10[precision])
+                exp10++;
+            else if (mantissa < pow10[precision - 1])
+                exp10--;
+            else
+                break;
+        }
+        if (exp10 < -4 || exp10 >= precision)
+            return NULL;
+        decimals = precision - 1 - exp10;
+        while (decimals > 0 && (mantissa % 10) == 0) // Remove trailing zeroes
+        {
+            mantissa /= 10;
+            decimals--;
+        }
+    }
+
+    char* p = out_end;
+    if (decimals > 0)
+    {
+        p = ImFormatWriteDigitsBackward(p, mantissa % pow10[decimals], 10, false, decimals);
+        *--p = '.';
+    }
+    p = ImFormatWriteDigitsBackward(p, mantissa / pow10[decimals], 10, false, 1);
+    return p;
+}
+
+static char* ImFormatAppendLiteral(char* out, char* out_end, const char* s, const char* s_end)
+{
+    for (; (s_end == NULL || s < s_end) && *s && out < out_end; s++)
+    {
+        if (*s == '%')
+            s++;
+        *out++ = *s;
+    }
+    return out;
+}
+
+// Return -1 if the fast path gave up, in which case the caller needs to format with vsnprintf() using a fresh copy of 'args'.
+static int ImFormatStringSimpleV(char* buf, size_t buf_size, const ImFormatSimpleSpec& spec, va_list args)
+{
+    char num_buf[64];
+    char* num_end = num_buf + IM_ARRAYSIZE(num_buf);
+    char* num = NULL;
+    bool negative = false;
+    if (spec.Type == 'f' || spec.Type == 'g')
+    {
+        const double v = va_arg(args, double);
+        ImU64 v_bits;
+        memcpy(&v_bits, &v, sizeof(v_bits));
+        negative = (v_bits >> 63) != 0; // Also print the sign of -0.0, same as printf()
+        num = ImFormatWriteFloatBackward(num_end, v, spec);
+        if (num == NULL)
+            return -1;
+    }
+    else if (spec.Type == 'd')
+    {
+        const ImS64 v = spec.Is64 ? va_arg(args, ImS64) : (ImS64)va_arg(args, int);
+        negative = (v < 0);
+        num = ImFormatWriteDigitsBackward(num_end, negative ? (ImU64)0 - (ImU64)v : (ImU64)v, 10, false, 1);
+    }
+    else
+    {
+        const ImU64 v = spec.Is64 ? va_arg(args, ImU64) : (ImU64)va_arg(args, unsigned int);
+        num = ImFormatWriteDigitsBackward(num_end, v, (spec.Type == 'u') ? 10 : 16, spec.Type == 'X', 1);
+    }
+
+    // Apply sign and width
+    int num_len = (int)(num_end - num) + (negative ? 1 : 0);
+    if (spec.ZeroPad)
+        for (; num_len < spec.Width; num_len++)
+            *--num = '0';
+    if (negative)
+        *--num = '-';
+    for (; num_len < spec.Width; num_len++)
+        *--num = ' ';
+
+    // Assemble
+    char* out = buf;
+    char* out_end = buf + buf_size - 1;
+    out = ImFormatAppendLiteral(out, out_end, spec.Prefix, spec.PrefixEnd);
+    num_len = ImMin((int)(num_end - num), (int)(out_end - out));
+    memcpy(out, num, (size_t)num_len);
+    out += num_len;
+    out = ImFormatAppendLiteral(out, out_end, spec.Suffix, NULL);
+    *out = 0;
+    return (int)(out - buf);
+}
+#endif // #ifndef IMGUI_USE_STB_SPRINTF
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
+#ifndef IMGUI_USE_STB_SPRINTF
+    ImFormatSimpleSpec spec;
+    if (buf != NULL && buf_size > 0 && ImFormatParseSimple(fmt, &spec))
+    {
+        va_start(args, fmt);
+        int w = ImFormatStringSimpleV(buf, buf_size, spec, args);
+        va_end(args);
+        if (w >= 0)
+            return w;
+    }
+#endif
     va_start(args, fmt);
 #ifdef IMGUI_USE_STB_SPRINTF
     int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
@@ -1391,6 +1643,18 @@ int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 
 int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 {
+#ifndef IMGUI_USE_STB_SPRINTF
+    ImFormatSimpleSpec spec;
+    if (buf != NULL && buf_size > 0 && ImFormatParseSimple(fmt, &spec))
+    {
+        va_list args_copy;
+        va_copy(args_copy, args);
+        int w = ImFormatStringSimpleV(buf, buf_size, spec, args_copy);
+        va_end(args_copy);
+        if (w >= 0)
+            return w;
+    }
+#endif
 #ifdef IMGUI_USE_STB_SPRINTF
     int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
@@ -2069,16 +2333,6 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 // [SECTION] ImGuiTextBuffer
 //-----------------------------------------------------------------------------
 
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
-
 char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
@@ -2090,6 +2344,7 @@ void ImGuiTextBuffer::append(const char* str, const char* str_end)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_TextBuffer);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
     }
@@ -2125,6 +2380,7 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_TextBuffer);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
     }
@@ -2134,12 +2390,69 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_end(args_copy);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImFrameArena
+//-----------------------------------------------------------------------------
+
+// Main block is full: fallback to a heap allocation which will be released on the next Reset()
+void* ImFrameArena::AllocOverflow(size_t sz)
+{
+    void* p = IM_ALLOC(sz);
+    OverflowBlocks.push_back(p);
+    OverflowSize += (int)sz;
+    return p;
+}
+
+void ImFrameArena::Reset()
+{
+    const int used_size = Size + OverflowSize;
+    PeakSizeLastFrame = used_size;
+    PeakSizeEver = ImMax(PeakSizeEver, used_size);
+    for (int n = 0; n < OverflowBlocks.Size; n++)
+        IM_FREE(OverflowBlocks[n]);
+    OverflowBlocks.resize(0);
+    if (OverflowSize > 0)
+    {
+        // Grow main block to fit the peak usage, with some slack
+        int new_capacity = ImMax(used_size + used_size / 2, 4096);
+        if (Data)
+            IM_FREE(Data);
+        Data = (char*)IM_ALLOC((size_t)new_capacity);
+        Capacity = new_capacity;
+        OverflowCount++;
+    }
+    Size = OverflowSize = 0;
+}
+
+void ImFrameArena::Clear()
+{
+    for (int n = 0; n < OverflowBlocks.Size; n++)
+        IM_FREE(OverflowBlocks[n]);
+    OverflowBlocks.clear();
+    if (Data)
+        IM_FREE(Data);
+    Data = NULL;
+    Size = Capacity = OverflowSize = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be and really confusing/spaghetti, mostly because we changed
 // the API mid-way through development and support two ways to using the clipper, needs some rework (see TODO)
 //-----------------------------------------------------------------------------
 
+// We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
+static ImRect GetListClippingRect(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImRect unclipped_rect = window->ClipRect;
+    if (g.NavMoveRequest)
+        unclipped_rect.Add(g.NavScoringRect);
+    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
+        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
+    return unclipped_rect;
+}
+
 // Helper to calculate coarse clipping of large list of evenly sized items.
 // NB: Prefer using the ImGuiListClipper higher-level helper if you can! Read comments and instructions there on how those use this sort of pattern.
 // NB: 'items_count' is only used to clamp the result, if you don't know your count you can use INT_MAX
@@ -2160,13 +2473,7 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
         return;
     }
 
-    // We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
-    ImRect unclipped_rect = window->ClipRect;
-    if (g.NavMoveRequest)
-        unclipped_rect.Add(g.NavScoringRect);
-    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
-        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
-
+    const ImRect unclipped_rect = GetListClippingRect(window);
     const ImVec2 pos = window->DC.CursorPos;
     int start = (int)((unclipped_rect.Min.y - pos.y) / items_height);
     int end = (int)((unclipped_rect.Max.y - pos.y) / items_height);
@@ -2223,6 +2530,19 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StepNo = 0;
     DisplayStart = -1;
     DisplayEnd = 0;
+    Heights = NULL;
+}
+
+void ImGuiListClipper::Begin(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "Items of variable height require a known items count!");
+    IM_ASSERT(heights != NULL);
+    if (heights->DefaultHeight <= 0.0f)
+        heights->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+    if (heights->Heights.Size != items_count)
+        heights->Resize(items_count);
+    Begin(items_count, -1.0f);
+    Heights = heights;
 }
 
 void ImGuiListClipper::End()
@@ -2231,7 +2551,9 @@ void ImGuiListClipper::End()
         return;
 
     // In theory here we should assert that ImGui::GetCursorPosY() == StartPosY + DisplayEnd * ItemsHeight, but it feels saner to just seek at the end and not assert/crash the user.
-    if (ItemsCount < INT_MAX && DisplayStart >= 0)
+    if (Heights != NULL && DisplayStart >= 0)
+        SetCursorPosYAndSetupForPrevLine(StartPosY + Heights->GetTotalHeight(), Heights->GetHeight(ItemsCount - 1));
+    else if (ItemsCount < INT_MAX && DisplayStart >= 0)
         SetCursorPosYAndSetupForPrevLine(StartPosY + ItemsCount * ItemsHeight, ItemsHeight);
     ItemsCount = -1;
     StepNo = 3;
@@ -2242,6 +2564,60 @@ bool ImGuiListClipper::Step()
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
+    // Items of variable height: let the user process one item at a time, so we can measure each of them
+    if (Heights != NULL)
+    {
+        if (StepNo == 0)
+        {
+            if (ItemsCount == 0 || window->SkipItems)
+            {
+                End();
+                return false;
+            }
+
+            // Find the first visible item from the heights we know, and position the cursor before it
+            const ImRect unclipped_rect = GetListClippingRect(window);
+            StartPosY = window->DC.CursorPos.y;
+            int start = g.LogEnabled ? 0 : Heights->FindItem(unclipped_rect.Min.y - StartPosY);
+            if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Up)
+                start = ImMax(start - 1, 0);
+            if (start > 0)
+                SetCursorPosYAndSetupForPrevLine(StartPosY + Heights->GetOffset(start), Heights->GetHeight(start - 1));
+            EndPosY = g.LogEnabled ? FLT_MAX : unclipped_rect.Max.y;
+            ItemPosY = window->DC.CursorPos.y;
+            DisplayStart = start;
+            DisplayEnd = start + 1;
+            StepNo = 4;
+            return true;
+        }
+
+        // Measure the item which was just submitted. When the first item is partially scrolled out at the top and its height changes
+        // (e.g. measured for the first time), scroll by the difference so the next items don't move on the next frame.
+        const float item_height = window->DC.CursorPos.y - ItemPosY;
+        if (ItemPosY < window->ClipRect.Min.y && window->ScrollTarget.y == FLT_MAX)
+            window->Scroll.y += item_height - Heights->GetHeight(DisplayStart);
+        Heights->SetHeight(DisplayStart, item_height);
+        ItemPosY = window->DC.CursorPos.y;
+
+        // Stop after the last visible item. When performing a navigation request, submit one item extra in the direction we are moving to.
+        bool done = (StepNo == 5 || DisplayEnd >= ItemsCount);
+        if (!done && ItemPosY >= EndPosY)
+        {
+            if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Down)
+                StepNo = 5;
+            else
+                done = true;
+        }
+        if (done)
+        {
+            End();
+            return false;
+        }
+        DisplayStart = DisplayEnd;
+        DisplayEnd = DisplayStart + 1;
+        return true;
+    }
+
     // Reached end of list
     if (DisplayEnd >= ItemsCount || window->SkipItems)
     {
@@ -2309,6 +2685,94 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+void ImGuiListClipper::ScrollToItem(int item_idx, float center_y_ratio)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(ItemsCount >= 0 && "Call ScrollToItem() after Begin()!");
+    IM_ASSERT(item_idx >= 0 && item_idx < ItemsCount);
+    float item_offset, item_height;
+    if (Heights != NULL)
+    {
+        item_offset = Heights->GetOffset(item_idx);
+        item_height = Heights->GetHeight(item_idx);
+    }
+    else
+    {
+        IM_ASSERT(ItemsHeight > 0.0f && "Items height is unknown, pass it to Begin()!");
+        item_offset = item_idx * ItemsHeight;
+        item_height = ItemsHeight;
+    }
+
+    // Same as SetScrollHereY() after submitting the item
+    const float spacing_y = g.Style.ItemSpacing.y;
+    const float item_pos_y = StartPosY + item_offset;
+    const float target_pos_y = ImLerp(item_pos_y - spacing_y, item_pos_y + item_height, center_y_ratio);
+    ImGui::SetScrollFromPosY(window, target_pos_y - window->Pos.y, center_y_ratio);
+    window->ScrollTargetEdgeSnapDist.y = ImMax(0.0f, window->WindowPadding.y - spacing_y);
+}
+
+// Heights are stored in a Fenwick tree (binary indexed tree) of partial sums, using doubles as floats would lose
+// precision past a few million pixels, and as SetHeight() accumulates differences into the sums.
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    const int old_count = Heights.Size;
+    Heights.resize(items_count, DefaultHeight);
+    Sums.resize(items_count);
+
+    // New nodes: the range covered by node n is made of Heights[n - 1] and of the ranges of nodes n - 1, n - 2, n - 4... (n - (n & -n), excluded)
+    for (int n = old_count + 1; n <= items_count; n++)
+    {
+        double sum = Heights[n - 1];
+        for (int child_size = 1; child_size < (n & -n); child_size <<= 1)
+            sum += Sums[n - child_size - 1];
+        Sums[n - 1] = sum;
+    }
+}
+
+void ImGuiListClipperHeights::Clear()
+{
+    Heights.clear();
+    Sums.clear();
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_idx, float height)
+{
+    IM_ASSERT(item_idx >= 0 && item_idx < Heights.Size);
+    const double delta = (double)height - Heights[item_idx];
+    if (delta == 0.0)
+        return;
+    Heights[item_idx] = height;
+    for (int n = item_idx + 1; n <= Sums.Size; n += n & -n)
+        Sums[n - 1] += delta;
+}
+
+float ImGuiListClipperHeights::GetOffset(int item_idx) const
+{
+    IM_ASSERT(item_idx >= 0 && item_idx <= Heights.Size);
+    double sum = 0.0;
+    for (int n = item_idx; n > 0; n -= n & -n)
+        sum += Sums[n - 1];
+    return (float)sum;
+}
+
+int ImGuiListClipperHeights::FindItem(float offset) const
+{
+    // Binary search down the tree: find the number of items whose bottom is above 'offset'
+    int count = 0;
+    double remaining = offset;
+    int step = 1;
+    while (step * 2 <= Sums.Size)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (count + step <= Sums.Size && Sums[count + step - 1] <= remaining)
+        {
+            count += step;
+            remaining -= Sums[count - 1];
+        }
+    return ImClamp(count, 0, ImMax(Heights.Size - 1, 0));
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -2319,12 +2783,27 @@ ImGuiStyle& ImGui::GetStyle()
     return GImGui->Style;
 }
 
+// Packed style colors are cached in the context: the float->int conversion is only done again when the source color or style.Alpha changed,
+// which is generally after PushStyleColor()/PopStyleColor()/PushStyleVar(ImGuiStyleVar_Alpha) or after an edit of the style.
+// Comparing with the source value (instead of relying on explicit invalidation) keeps direct writes to ImGuiStyle working at any point in the frame.
 ImU32 ImGui::GetColorU32(ImGuiCol idx, float alpha_mul)
 {
-    ImGuiStyle& style = GImGui->Style;
+    ImGuiContext& g = *GImGui;
+    ImGuiStyle& style = g.Style;
     ImVec4 c = style.Colors[idx];
-    c.w *= style.Alpha * alpha_mul;
-    return ColorConvertFloat4ToU32(c);
+    if (alpha_mul != 1.0f)
+    {
+        c.w *= style.Alpha * alpha_mul;
+        return ColorConvertFloat4ToU32(c);
+    }
+    c.w *= style.Alpha;
+    ImVec4& cached_c = g.StyleColorsU32Src[idx];
+    if (cached_c.x != c.x || cached_c.y != c.y || cached_c.z != c.z || cached_c.w != c.w)
+    {
+        cached_c = c;
+        g.StyleColorsU32[idx] = ColorConvertFloat4ToU32(c);
+    }
+    return g.StyleColorsU32[idx];
 }
 
 ImU32 ImGui::GetColorU32(const ImVec4& col)
@@ -2809,6 +3288,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     Appearing = false;
     Hidden = false;
     IsFallbackWindow = false;
+    IsOpaque = false;
     HasCloseButton = false;
     ResizeBorderHeld = -1;
     BeginCount = 0;
@@ -2837,6 +3317,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     RootWindow = NULL;
     RootWindowForTitleBarHighlight = NULL;
     RootWindowForNav = NULL;
+    OccludedBy = NULL;
 
     NavLastIds[0] = NavLastIds[1] = 0;
     NavRectRel[0] = NavRectRel[1] = ImRect();
@@ -2955,22 +3436,159 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
-    window->DC.ItemFlagsStack.clear();
-    window->DC.ItemWidthStack.clear();
-    window->DC.TextWrapPosStack.clear();
-    window->DC.GroupStack.clear();
+    window->DrawListsAppended.clear();
 }
 
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
 {
     // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
     // The other buffers tends to amortize much faster.
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_Windows);
     window->MemoryCompacted = false;
     window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
     window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+static size_t GcCalcSplitterSize(const ImDrawListSplitter* splitter)
+{
+    size_t sz = (size_t)splitter->_Channels.Capacity * sizeof(ImDrawChannel);
+    for (int i = 0; i < splitter->_Channels.Size; i++)
+        if (i != splitter->_Current) // Current channel is a copy of the ImDrawList buffers
+            sz += (size_t)splitter->_Channels[i]._CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)splitter->_Channels[i]._IdxBuffer.Capacity * sizeof(ImDrawIdx);
+    return sz;
+}
+
+// Bytes that could be reclaimed from a draw list by shrinking its main buffers to their current size
+static size_t GcCalcDrawListSlack(const ImDrawList* draw_list)
+{
+    return (size_t)(draw_list->CmdBuffer.Capacity - draw_list->CmdBuffer.Size) * sizeof(ImDrawCmd) + (size_t)(draw_list->IdxBuffer.Capacity - draw_list->IdxBuffer.Size) * sizeof(ImDrawIdx) + (size_t)(draw_list->VtxBuffer.Capacity - draw_list->VtxBuffer.Size) * sizeof(ImDrawVert);
+}
+
+// Bytes held by the buffers of a window that garbage collection may release (the ImGuiWindow itself, its name and storage are not included)
+size_t ImGui::GcCalcTransientWindowBuffersSize(ImGuiWindow* window)
+{
+    const ImDrawList* draw_list = window->DrawList;
+    size_t sz = 0;
+    sz += (size_t)draw_list->CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)draw_list->IdxBuffer.Capacity * sizeof(ImDrawIdx) + (size_t)draw_list->VtxBuffer.Capacity * sizeof(ImDrawVert);
+    sz += (size_t)draw_list->_ClipRectStack.Capacity * sizeof(ImVec4) + (size_t)draw_list->_TextureIdStack.Capacity * sizeof(ImTextureID) + (size_t)draw_list->_Path.Capacity * sizeof(ImVec2);
+    sz += GcCalcSplitterSize(&draw_list->_Splitter);
+    sz += (size_t)window->IDStack.Capacity * sizeof(ImGuiID) + (size_t)window->DC.ChildWindows.Capacity * sizeof(ImGuiWindow*);
+    for (int n = 0; n < window->ColumnsStorage.Size; n++)
+        sz += (size_t)window->ColumnsStorage[n].Columns.Capacity * sizeof(ImGuiColumnData) + GcCalcSplitterSize(&window->ColumnsStorage[n].Splitter);
+    return sz;
+}
+
+static int IMGUI_CDECL GcWindowComparerByLastTimeActive(const void* lhs, const void* rhs)
+{
+    const ImGuiWindow* const a = *(const ImGuiWindow* const *)lhs;
+    const ImGuiWindow* const b = *(const ImGuiWindow* const *)rhs;
+    return (a->LastTimeActive < b->LastTimeActive) ? -1 : (a->LastTimeActive > b->LastTimeActive) ? +1 : 0;
+}
+
+static int IMGUI_CDECL GcWindowComparerByDrawListSlack(const void* lhs, const void* rhs)
+{
+    const size_t a = GcCalcDrawListSlack((*(const ImGuiWindow* const *)lhs)->DrawList);
+    const size_t b = GcCalcDrawListSlack((*(const ImGuiWindow* const *)rhs)->DrawList);
+    return (a > b) ? -1 : (a < b) ? +1 : 0;
+}
+
+// Called by NewFrame() when g.GcMemoryUsage exceeds io.ConfigMemoryCompactBudget. In order, until we fit the budget:
+// - compact unused windows, least recently used first.
+// - release line breaks of wrapped texts which weren't displayed during the last frame.
+// - release the text input state if it is not in use (this discards its undo stack).
+// - shrink active windows whose draw lists or channels are holding onto a past spike (more than twice what they used last frame).
+void ImGui::GcCompactToMemoryBudget(size_t budget)
+{
+    ImGuiContext& g = *GImGui;
+    size_t usage = g.GcMemoryUsage;
+
+    ImFrameArenaVector<ImGuiWindow*> unused_windows, active_windows;
+    unused_windows.Reset(&g.FrameArena);
+    active_windows.Reset(&g.FrameArena);
+    for (int i = 0; i != g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (!window->WasActive && !window->MemoryCompacted)
+            unused_windows.push_back(window);
+        else if (window->WasActive)
+            active_windows.push_back(window);
+    }
+
+    if (unused_windows.Size > 1)
+        ImQsort(unused_windows.Data, (size_t)unused_windows.Size, sizeof(ImGuiWindow*), GcWindowComparerByLastTimeActive);
+    for (int i = 0; i < unused_windows.Size && usage > budget; i++)
+    {
+        // Don't restore the spike capacity when the window reappears, only what it used when it was last active
+        ImGuiWindow* window = unused_windows[i];
+        const int idx_size = window->DrawList->IdxBuffer.Size;
+        const int vtx_size = window->DrawList->VtxBuffer.Size;
+        usage -= GcCalcTransientWindowBuffersSize(window);
+        GcCompactTransientWindowBuffers(window);
+        window->MemoryDrawListIdxCapacity = idx_size;
+        window->MemoryDrawListVtxCapacity = vtx_size;
+        usage += GcCalcTransientWindowBuffersSize(window);
+        g.GcMemoryCompactCount++;
+    }
+
+    for (int n = 0; n < g.TextWrapCaches.Map.Data.Size && usage > budget; n++)
+    {
+        ImGuiStorage::ImGuiStoragePair& pair = g.TextWrapCaches.Map.Data[n];
+        if (pair.val_i == -1)
+            continue;
+        ImGuiTextWrapCache* cache = g.TextWrapCaches.GetByIndex(pair.val_i);
+        if (cache->LastFrameUsed >= g.FrameCount - 1)
+            continue;
+        usage -= (size_t)cache->Text.Capacity + (size_t)cache->Lines.Capacity * sizeof(ImGuiTextWrapCache::Line);
+        g.TextWrapCaches.Remove(pair.key, pair.val_i);
+        g.GcMemoryCompactCount++;
+    }
+
+    ImGuiInputTextState* input_state = &g.InputTextState;
+    if (usage > budget && input_state->ID != g.ActiveId && input_state->TextW.Capacity + input_state->TextA.Capacity + input_state->InitialTextA.Capacity > 0)
+    {
+        usage -= (size_t)input_state->TextW.Capacity * sizeof(ImWchar) + (size_t)input_state->TextA.Capacity + (size_t)input_state->InitialTextA.Capacity;
+        input_state->ClearFreeMemory();
+        input_state->ID = 0;
+        g.GcMemoryCompactCount++;
+    }
+
+    if (active_windows.Size > 1 && usage > budget)
+        ImQsort(active_windows.Data, (size_t)active_windows.Size, sizeof(ImGuiWindow*), GcWindowComparerByDrawListSlack);
+    for (int i = 0; i < active_windows.Size && usage > budget; i++)
+    {
+        // Draw data from last frame has been invalidated already, so we only need to preserve capacity for the contents size.
+        ImGuiWindow* window = active_windows[i];
+        ImDrawList* draw_list = window->DrawList;
+        const bool shrink_draw_list = (draw_list->VtxBuffer.Capacity > draw_list->VtxBuffer.Size * 2 || draw_list->IdxBuffer.Capacity > draw_list->IdxBuffer.Size * 2);
+        size_t splitters_size = GcCalcSplitterSize(&draw_list->_Splitter);
+        for (int n = 0; n < window->ColumnsStorage.Size; n++)
+            splitters_size += GcCalcSplitterSize(&window->ColumnsStorage[n].Splitter);
+        const size_t draw_list_used_size = (size_t)draw_list->CmdBuffer.Size * sizeof(ImDrawCmd) + (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx) + (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert);
+        const bool shrink_splitters = (splitters_size > draw_list_used_size);
+        if (!shrink_draw_list && !shrink_splitters)
+            continue;
+        usage -= GcCalcTransientWindowBuffersSize(window);
+        if (shrink_draw_list)
+        {
+            const int cmd_size = draw_list->CmdBuffer.Size, idx_size = draw_list->IdxBuffer.Size, vtx_size = draw_list->VtxBuffer.Size;
+            draw_list->_ClearFreeMemory();
+            draw_list->CmdBuffer.reserve(cmd_size);
+            draw_list->IdxBuffer.reserve(idx_size);
+            draw_list->VtxBuffer.reserve(vtx_size);
+        }
+        if (shrink_splitters)
+        {
+            draw_list->_Splitter.ClearFreeMemory();
+            for (int n = 0; n < window->ColumnsStorage.Size; n++)
+                window->ColumnsStorage[n].Splitter.ClearFreeMemory();
+        }
+        usage += GcCalcTransientWindowBuffersSize(window);
+        g.GcMemoryCompactCount++;
+    }
+    g.GcMemoryUsage = usage;
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -3243,7 +3861,17 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
+    {
         ctx->IO.MetricsActiveAllocations++;
+        ctx->DebugAllocStatsThisFrame.Count[ctx->DebugAllocCategory]++;
+        ctx->DebugAllocStatsThisFrame.Bytes[ctx->DebugAllocCategory] += size;
+        ctx->DebugAllocStatsTotal.Count[ctx->DebugAllocCategory]++;
+        ctx->DebugAllocStatsTotal.Bytes[ctx->DebugAllocCategory] += size;
+
+        // If this assert triggers: something allocated after io.ConfigDebugNoAllocAfterFrames frames. Check the callstack, or Metrics->Allocations for a breakdown.
+        // Note that saving the .ini file allocates: you may set io.IniFilename = NULL when performing this check.
+        IM_ASSERT(!ctx->DebugAllocAssertEnabled && "Unexpected allocation after warm-up! (see io.ConfigDebugNoAllocAfterFrames)");
+    }
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
 }
 
@@ -3256,6 +3884,162 @@ void ImGui::MemFree(void* ptr)
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+void ImGui::DebugGetAllocStats(ImGuiAllocStats* out_last_frame, ImGuiAllocStats* out_total)
+{
+    ImGuiContext& g = *GImGui;
+    if (out_last_frame)
+        *out_last_frame = g.DebugAllocStatsLastFrame;
+    if (out_total)
+        *out_total = g.DebugAllocStatsTotal;
+}
+
+template<typename T>
+static void AddVectorMemoryStats(ImGuiMemoryStats* stats, ImGuiMemoryCategory category, const ImVector<T>& v)
+{
+    stats->UsedBytes[category] += (size_t)v.Size * sizeof(T);
+    stats->ReservedBytes[category] += (size_t)v.Capacity * sizeof(T);
+}
+
+static void AddBlockMemoryStats(ImGuiMemoryStats* stats, ImGuiMemoryCategory category, size_t sz)
+{
+    stats->UsedBytes[category] += sz;
+    stats->ReservedBytes[category] += sz;
+}
+
+static void AddDrawListMemoryStats(ImGuiMemoryStats* stats, const ImDrawList* draw_list)
+{
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawLists, draw_list->CmdBuffer);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawLists, draw_list->IdxBuffer);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawLists, draw_list->VtxBuffer);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawLists, draw_list->_ClipRectStack);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawLists, draw_list->_TextureIdStack);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawLists, draw_list->_Path);
+}
+
+static void AddSplitterMemoryStats(ImGuiMemoryStats* stats, const ImDrawListSplitter* splitter)
+{
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawChannels, splitter->_Channels);
+    for (int i = 0; i < splitter->_Channels.Size; i++)
+        if (i != splitter->_Current) // Current channel is a copy of the ImDrawList buffers
+        {
+            AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawChannels, splitter->_Channels[i]._CmdBuffer);
+            AddVectorMemoryStats(stats, ImGuiMemoryCategory_DrawChannels, splitter->_Channels[i]._IdxBuffer);
+        }
+}
+
+void ImGui::GetMemoryStats(ImGuiMemoryStats* out_stats)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMemoryStats* stats = out_stats;
+    *stats = ImGuiMemoryStats();
+
+    // Windows
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, g.Windows);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, g.WindowsFocusOrder);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, g.WindowsById.Data);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, g.ChildWindowsByParentId.Data);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, g.WindowsHotData);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, g.WindowsPoolBlocks);
+    stats->UsedBytes[ImGuiMemoryCategory_Windows] += (size_t)g.Windows.Size * sizeof(ImGuiWindow);
+    stats->ReservedBytes[ImGuiMemoryCategory_Windows] += (size_t)g.WindowsPoolBlocks.Size * WINDOWS_POOL_BLOCK_SIZE * sizeof(ImGuiWindow);
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        AddBlockMemoryStats(stats, ImGuiMemoryCategory_Windows, strlen(window->Name) + 1);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, window->IDStack);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, window->StateStorage.Data);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Windows, window->DC.ChildWindows);
+        AddDrawListMemoryStats(stats, window->DrawList);
+        AddSplitterMemoryStats(stats, &window->DrawList->_Splitter);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Columns, window->ColumnsStorage);
+        for (int n = 0; n < window->ColumnsStorage.Size; n++)
+        {
+            AddVectorMemoryStats(stats, ImGuiMemoryCategory_Columns, window->ColumnsStorage[n].Columns);
+            AddSplitterMemoryStats(stats, &window->ColumnsStorage[n].Splitter);
+        }
+    }
+    AddDrawListMemoryStats(stats, &g.BackgroundDrawList);
+    AddDrawListMemoryStats(stats, &g.ForegroundDrawList);
+
+    // Fonts
+    if (ImFontAtlas* atlas = g.IO.Fonts)
+    {
+        if (atlas->TexPixelsAlpha8)
+            AddBlockMemoryStats(stats, ImGuiMemoryCategory_Fonts, (size_t)atlas->TexWidth * (size_t)atlas->TexHeight);
+        if (atlas->TexPixelsRGBA32)
+            AddBlockMemoryStats(stats, ImGuiMemoryCategory_Fonts, (size_t)atlas->TexWidth * (size_t)atlas->TexHeight * 4);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Fonts, atlas->Fonts);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Fonts, atlas->CustomRects);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Fonts, atlas->ConfigData);
+        for (int n = 0; n < atlas->ConfigData.Size; n++)
+            if (atlas->ConfigData[n].FontDataOwnedByAtlas && atlas->ConfigData[n].FontData)
+                AddBlockMemoryStats(stats, ImGuiMemoryCategory_Fonts, (size_t)atlas->ConfigData[n].FontDataSize);
+        for (int n = 0; n < atlas->Fonts.Size; n++)
+        {
+            ImFont* font = atlas->Fonts[n];
+            AddBlockMemoryStats(stats, ImGuiMemoryCategory_Fonts, sizeof(ImFont));
+            AddVectorMemoryStats(stats, ImGuiMemoryCategory_Fonts, font->IndexAdvanceX);
+            AddVectorMemoryStats(stats, ImGuiMemoryCategory_Fonts, font->IndexLookup);
+            AddVectorMemoryStats(stats, ImGuiMemoryCategory_Fonts, font->Glyphs);
+        }
+    }
+
+    // Settings
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Settings, g.SettingsIniData.Buf);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Settings, g.SettingsHandlers);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Settings, g.SettingsWindows.Buf);
+
+    // Text input
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_InputText, g.InputTextState.TextW);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_InputText, g.InputTextState.TextA);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_InputText, g.InputTextState.InitialTextA);
+
+    // Tab bars
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_TabBars, g.TabBars.Buf);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_TabBars, g.TabBars.Map.Data);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_TabBars, g.CurrentTabBarStack);
+    for (int n = 0; n < g.TabBars.GetSize(); n++)
+    {
+        ImGuiTabBar* tab_bar = g.TabBars.GetByIndex(n);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_TabBars, tab_bar->Tabs);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_TabBars, tab_bar->TabsNames.Buf);
+    }
+
+    // Other
+    stats->UsedBytes[ImGuiMemoryCategory_Other] += (size_t)g.FrameArena.PeakSizeLastFrame;
+    stats->ReservedBytes[ImGuiMemoryCategory_Other] += (size_t)g.FrameArena.Capacity;
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Other, g.DrawDataBuilder.Layers[0]);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Other, g.DrawDataBuilder.Layers[1]);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Other, g.TextWrapCaches.Buf);
+    AddVectorMemoryStats(stats, ImGuiMemoryCategory_Other, g.TextWrapCaches.Map.Data);
+    for (int n = 0; n < g.TextWrapCaches.Map.Data.Size; n++)
+    {
+        if (g.TextWrapCaches.Map.Data[n].val_i == -1)
+            continue;
+        ImGuiTextWrapCache* cache = g.TextWrapCaches.GetByIndex(g.TextWrapCaches.Map.Data[n].val_i);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Other, cache->Text);
+        AddVectorMemoryStats(stats, ImGuiMemoryCategory_Other, cache->Lines);
+    }
+}
+
+const char* ImGui::GetMemoryCategoryName(ImGuiMemoryCategory category)
+{
+    switch (category)
+    {
+    case ImGuiMemoryCategory_Windows: return "Windows";
+    case ImGuiMemoryCategory_DrawLists: return "DrawLists";
+    case ImGuiMemoryCategory_DrawChannels: return "DrawChannels";
+    case ImGuiMemoryCategory_Fonts: return "Fonts";
+    case ImGuiMemoryCategory_Settings: return "Settings";
+    case ImGuiMemoryCategory_InputText: return "InputText";
+    case ImGuiMemoryCategory_TabBars: return "TabBars";
+    case ImGuiMemoryCategory_Columns: return "Columns";
+    case ImGuiMemoryCategory_Other: return "Other";
+    }
+    IM_ASSERT(0);
+    return "Unknown";
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3761,6 +4545,15 @@ void ImGui::NewFrame()
 
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
 
+    // Rotate allocation counters
+    g.DebugAllocStatsLastFrame = g.DebugAllocStatsThisFrame;
+    g.DebugAllocStatsThisFrame.Clear();
+    g.IO.MetricsFrameAllocations = g.DebugAllocStatsLastFrame.GetTotalCount();
+    g.DebugAllocAssertEnabled = (g.IO.ConfigDebugNoAllocAfterFrames >= 0 && g.FrameCount >= g.IO.ConfigDebugNoAllocAfterFrames);
+
+    // Release transient data of the previous frame (grows the arena if the previous frame overflowed it)
+    g.FrameArena.Reset();
+
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
 
@@ -3781,7 +4574,10 @@ void ImGui::NewFrame()
     g.IO.Framerate = (g.FramerateSecPerFrameAccum > 0.0f) ? (1.0f / (g.FramerateSecPerFrameAccum / (float)IM_ARRAYSIZE(g.FramerateSecPerFrame))) : FLT_MAX;
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // Lock the font atlas, unless it was already locked by the user (e.g. to be shared between contexts running on different threads)
+    g.FontAtlasLockedByContext = !g.IO.Fonts->Locked;
+    if (g.FontAtlasLockedByContext)
+        g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
@@ -3893,8 +4689,12 @@ void ImGui::NewFrame()
     UpdateTabFocus();
 
     // Mark all windows as not visible and compact unused memory.
+    g.WindowsHotDataDirty = true;
+    g.WindowsOccludedCount = 0;
     IM_ASSERT(g.WindowsFocusOrder.Size == g.Windows.Size);
     const float memory_compact_start_time = (g.IO.ConfigWindowsMemoryCompactTimer >= 0.0f) ? (float)g.Time - g.IO.ConfigWindowsMemoryCompactTimer : FLT_MAX;
+    const bool memory_budget_enabled = (g.IO.ConfigMemoryCompactBudget > 0);
+    size_t memory_usage = 0;
     for (int i = 0; i != g.Windows.Size; i++)
     {
         ImGuiWindow* window = g.Windows[i];
@@ -3906,8 +4706,30 @@ void ImGui::NewFrame()
         // Garbage collect transient buffers of recently unused windows
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
+        if (memory_budget_enabled)
+            memory_usage += GcCalcTransientWindowBuffersSize(window);
+    }
+
+    // Garbage collect line breaks of wrapped texts which haven't been displayed recently
+    for (int n = 0; n < g.TextWrapCaches.Map.Data.Size; n++)
+    {
+        ImGuiStorage::ImGuiStoragePair& pair = g.TextWrapCaches.Map.Data[n];
+        if (pair.val_i == -1)
+            continue;
+        ImGuiTextWrapCache* cache = g.TextWrapCaches.GetByIndex(pair.val_i);
+        if (cache->LastFrameUsed < g.FrameCount - 1 && cache->LastTimeUsed < memory_compact_start_time)
+            g.TextWrapCaches.Remove(pair.key, pair.val_i);
+        else if (memory_budget_enabled)
+            memory_usage += (size_t)cache->Text.Capacity + (size_t)cache->Lines.Capacity * sizeof(ImGuiTextWrapCache::Line);
     }
 
+    // Garbage collect transient buffers to fit the memory budget
+    if (memory_budget_enabled)
+        memory_usage += (size_t)g.InputTextState.TextW.Capacity * sizeof(ImWchar) + (size_t)g.InputTextState.TextA.Capacity + (size_t)g.InputTextState.InitialTextA.Capacity;
+    g.GcMemoryUsage = memory_usage;
+    if (memory_budget_enabled && memory_usage > (size_t)g.IO.ConfigMemoryCompactBudget)
+        GcCompactToMemoryBudget((size_t)g.IO.ConfigMemoryCompactBudget);
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(NULL, NULL);
@@ -4009,6 +4831,7 @@ void ImGui::Shutdown(ImGuiContext* context)
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
         return;
+    g.DebugAllocAssertEnabled = false;
 
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
@@ -4023,13 +4846,20 @@ void ImGui::Shutdown(ImGuiContext* context)
 
     // Clear everything else
     for (int i = 0; i < g.Windows.Size; i++)
-        IM_DELETE(g.Windows[i]);
+        g.Windows[i]->~ImGuiWindow();
+    for (int i = 0; i < g.WindowsPoolBlocks.Size; i++)
+        IM_FREE(g.WindowsPoolBlocks[i]);
+    g.WindowsPoolBlocks.clear();
+    g.WindowsPoolBlockUsed = 0;
     g.Windows.clear();
+    g.WindowsHotData.clear();
+    g.WindowsHotDataDirty = true;
     g.WindowsFocusOrder.clear();
-    g.WindowsTempSortBuffer.clear();
+    g.FrameArena.Clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
+    g.ChildWindowsByParentId.Clear();
     g.NavWindow = NULL;
     g.HoveredWindow = g.HoveredRootWindow = g.HoveredWindowUnderMovingWindow = NULL;
     g.ActiveIdWindow = g.ActiveIdPreviousFrameWindow = NULL;
@@ -4046,6 +4876,7 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
     g.ShrinkWidthBuffer.clear();
+    g.TextWrapCaches.Clear();
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
@@ -4079,7 +4910,7 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
     return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
 }
 
-static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
+static void AddWindowToSortBuffer(ImFrameArenaVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
 {
     out_sorted_windows->push_back(window);
     if (window->Active)
@@ -4137,6 +4968,8 @@ static void AddWindowToDrawData(ImVector<ImDrawList*>* out_render_list, ImGuiWin
     ImGuiContext& g = *GImGui;
     g.IO.MetricsRenderWindows++;
     AddDrawListToDrawData(out_render_list, window->DrawList);
+    for (int i = 0; i < window->DrawListsAppended.Size; i++)
+        AddDrawListToDrawData(out_render_list, window->DrawListsAppended[i]);
     for (int i = 0; i < window->DC.ChildWindows.Size; i++)
     {
         ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -4265,23 +5098,29 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
-    g.WindowsTempSortBuffer.resize(0);
-    g.WindowsTempSortBuffer.reserve(g.Windows.Size);
+    ImFrameArenaVector<ImGuiWindow*> sorted_windows;
+    sorted_windows.Reset(&g.FrameArena);
+    sorted_windows.reserve(g.Windows.Size);
     for (int i = 0; i != g.Windows.Size; i++)
     {
         ImGuiWindow* window = g.Windows[i];
         if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
             continue;
-        AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        AddWindowToSortBuffer(&sorted_windows, window);
     }
 
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
-    IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
+    IM_ASSERT(g.Windows.Size == sorted_windows.Size);
+    if (g.Windows.Size > 0)
+        memcpy(g.Windows.Data, sorted_windows.Data, (size_t)g.Windows.Size * sizeof(ImGuiWindow*));
+    UpdateWindowsHotData();
+    UpdateWindowsOcclusion();
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (g.FontAtlasLockedByContext)
+        g.IO.Fonts->Locked = false;
+    g.FontAtlasLockedByContext = false;
 
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
@@ -4316,7 +5155,15 @@ void ImGui::Render()
     {
         ImGuiWindow* window = g.Windows[n];
         if (IsWindowActiveAndVisible(window) && (window->Flags & ImGuiWindowFlags_ChildWindow) == 0 && window != windows_to_render_top_most[0] && window != windows_to_render_top_most[1])
+        {
+            // Windows found covered by EndFrame() but submitted before their occluder were not culled by Begin(): leave out their draw list
+            if (g.IO.ConfigWindowsOcclusionCulling && window->OccludedBy != NULL)
+            {
+                g.WindowsOccludedCount++;
+                continue;
+            }
             AddRootWindowToDrawData(window);
+        }
     }
     for (int n = 0; n < IM_ARRAYSIZE(windows_to_render_top_most); n++)
         if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
@@ -4363,6 +5210,98 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+// Copy the fields of visible windows accepting mouse inputs read by FindHoveredWindow(), in display order (back to front).
+// Called by EndFrame() after sorting g.Windows, and on demand if g.Windows has been reordered since.
+static void UpdateWindowsHotData()
+{
+    ImGuiContext& g = *GImGui;
+    g.WindowsHotData.resize(0);
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (!window->Active || window->Hidden)
+            continue;
+        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+            continue;
+        ImGuiWindowHotData hot_data;
+        hot_data.Window = window;
+        hot_data.RootWindow = window->RootWindow;
+        hot_data.OuterRectClipped = window->OuterRectClipped;
+        hot_data.Flags = window->Flags;
+        hot_data.HasHitTestHole = (window->HitTestHoleSize.x != 0);
+        g.WindowsHotData.push_back(hot_data);
+    }
+    g.WindowsHotDataDirty = false;
+}
+
+// The rounded corners of an occluder don't cover anything: either the occluder rectangle trimmed by 1 - 1/sqrt(2) ~= 0.29 of
+// its radius contains our rectangle, or our corners are at least as rounded and our rectangle is within the occluder's one.
+static bool IsWindowCoveredBy(ImGuiWindow* window, ImGuiWindow* occluder)
+{
+    if (window->WindowRounding >= occluder->WindowRounding && occluder->Rect().Contains(window->Rect()))
+        return true;
+    ImRect occluder_rect = occluder->OuterRectClipped;
+    occluder_rect.Expand(-occluder->WindowRounding * 0.30f);
+    return occluder_rect.Contains(window->OuterRectClipped);
+}
+
+// Find top-level windows fully covered by a single opaque window displayed above them, using the final display order.
+// Render() leaves out the draw list of those windows. During the next frame, Begin() skips their contents if their occluder
+// was already submitted and still covers them, unless IsWindowOccluded() finds another reason not to.
+// We don't try to test coverage by the union of multiple windows.
+static void UpdateWindowsOcclusion()
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.IO.ConfigWindowsOcclusionCulling)
+        return;
+
+    ImFrameArenaVector<ImGuiWindow*> occluders;
+    occluders.Reset(&g.FrameArena);
+    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        window->OccludedBy = NULL;
+        if (!window->Active || window->RootWindow != window)
+            continue;
+        if (!(window->Flags & (ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip)))
+            for (int n = 0; n < occluders.Size && window->OccludedBy == NULL; n++)
+                if (IsWindowCoveredBy(window, occluders[n]))
+                    window->OccludedBy = occluders[n];
+
+        // A window covered by an occluder can't occlude more than it, and windows culled during this frame are not rendered.
+        if (window->OccludedBy == NULL && !window->Hidden && window->IsOpaque)
+            occluders.push_back(window);
+    }
+}
+
+// Called by Begin() for windows found occluded at the end of last frame. Windows/rectangles may have changed since, so the occluder
+// needs to have been submitted during this frame before us: an occluder closed during this frame must not leave a blank hole.
+// We never cull a window the user is interacting with (focused, active item, moved, Ctrl+Tab target, parent of an open popup).
+static bool IsWindowOccluded(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* occluder = window->OccludedBy;
+    if (occluder == NULL || window->Appearing || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0)
+        return false;
+    if (!occluder->Active || occluder->Hidden || !occluder->IsOpaque || !IsWindowCoveredBy(window, occluder))
+        return false;
+    if (g.MovingWindow && (g.MovingWindow->RootWindow == occluder || g.MovingWindow->RootWindow == window))
+        return false;
+    if ((g.NavWindow && g.NavWindow->RootWindow == window) || (g.NavWindowingTarget && g.NavWindowingTarget->RootWindow == window) || (g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == window))
+        return false;
+    for (int n = 0; n < g.OpenPopupStack.Size; n++)
+    {
+        // The popup window is NULL until BeginPopup() is called, in which case we don't know its parent yet.
+        // SourceWindow is the focused window at the time of OpenPopup(), which may not be the window calling BeginPopup().
+        const ImGuiPopupData& popup = g.OpenPopupStack[n];
+        if (popup.Window == NULL || (popup.Window->ParentWindow && popup.Window->ParentWindow->RootWindow == window))
+            return false;
+        if (popup.SourceWindow && popup.SourceWindow->RootWindow == window)
+            return false;
+    }
+    return true;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
@@ -4376,19 +5315,19 @@ static void FindHoveredWindow()
     if (g.MovingWindow && !(g.MovingWindow->Flags & ImGuiWindowFlags_NoMouseInputs))
         hovered_window = g.MovingWindow;
 
+    // Window data read here was last written by Begin() during the previous frame, so we can use the copy made by EndFrame()
+    if (g.WindowsHotDataDirty)
+        UpdateWindowsHotData();
+
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS, WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS)) : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    for (int i = g.WindowsHotData.Size - 1; i >= 0; i--)
     {
-        ImGuiWindow* window = g.Windows[i];
-        if (!window->Active || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
+        const ImGuiWindowHotData* hot_data = &g.WindowsHotData[i];
 
         // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+        ImRect bb(hot_data->OuterRectClipped);
+        if (hot_data->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
             bb.Expand(padding_regular);
         else
             bb.Expand(padding_for_resize_from_edges);
@@ -4397,7 +5336,8 @@ static void FindHoveredWindow()
 
         // Support for one rectangular hole in any given window
         // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
+        ImGuiWindow* window = hot_data->Window;
+        if (hot_data->HasHitTestHole)
         {
             ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
             ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
@@ -4407,7 +5347,7 @@ static void FindHoveredWindow()
 
         if (hovered_window == NULL)
             hovered_window = window;
-        if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
+        if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || hot_data->RootWindow != g.MovingWindow->RootWindow))
             hovered_window_ignoring_moving_window = window;
         if (hovered_window && hovered_window_ignoring_moving_window)
             break;
@@ -4790,20 +5730,36 @@ bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, b
         size.y = ImMax(content_avail.y + size.y, 4.0f);
     SetNextWindowSize(size);
 
-    // Build up name. If you need to append to a same child from multiple location in the ID stack, use BeginChild(ImGuiID id) with a stable value.
-    char title[256];
-    if (name)
-        ImFormatString(title, IM_ARRAYSIZE(title), "%s/%s_%08X", parent_window->Name, name, id);
-    else
-        ImFormatString(title, IM_ARRAYSIZE(title), "%s/%08X", parent_window->Name, id);
+    // Lookup existing child window from (parent, id) first, so we don't need to format and hash its full title every frame.
+    // The title is only built the first time, it is made of the parent name, the optional child name and the id.
+    // If you need to append to a same child from multiple location in the ID stack, use BeginChild(ImGuiID id) with a stable value.
+    const ImGuiID child_key = name ? ImHashStr(name, 0, id) : id;
+    const ImGuiID lookup_id = ImHashData(&child_key, sizeof(child_key), parent_window->ID);
+    ImGuiWindow* child_window = (ImGuiWindow*)g.ChildWindowsByParentId.GetVoidPtr(lookup_id);
+    if (child_window && child_window->ChildId != id)
+        child_window = NULL;
 
     const float backup_border_size = g.Style.ChildBorderSize;
     if (!border)
         g.Style.ChildBorderSize = 0.0f;
-    bool ret = Begin(title, NULL, flags);
+    bool ret;
+    if (child_window)
+    {
+        ret = BeginWindowEx(child_window, false, child_window->Name, NULL, flags);
+    }
+    else
+    {
+        char title[256];
+        if (name)
+            ImFormatString(title, IM_ARRAYSIZE(title), "%s/%s_%08X", parent_window->Name, name, id);
+        else
+            ImFormatString(title, IM_ARRAYSIZE(title), "%s/%08X", parent_window->Name, id);
+        ret = Begin(title, NULL, flags);
+        g.ChildWindowsByParentId.SetVoidPtr(lookup_id, g.CurrentWindow);
+    }
     g.Style.ChildBorderSize = backup_border_size;
 
-    ImGuiWindow* child_window = g.CurrentWindow;
+    child_window = g.CurrentWindow;
     child_window->ChildId = id;
     child_window->AutoFitChildAxises = (ImS8)auto_fit_axises;
 
@@ -4929,9 +5885,16 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_Windows);
 
-    // Create window the first time
-    ImGuiWindow* window = IM_NEW(ImGuiWindow)(&g, name);
+    // Create window the first time (instances are allocated in blocks, they are only released on Shutdown)
+    if (g.WindowsPoolBlocks.Size == 0 || g.WindowsPoolBlockUsed == WINDOWS_POOL_BLOCK_SIZE)
+    {
+        g.WindowsPoolBlocks.push_back(IM_ALLOC(sizeof(ImGuiWindow) * WINDOWS_POOL_BLOCK_SIZE));
+        g.WindowsPoolBlockUsed = 0;
+    }
+    ImGuiWindow* window = (ImGuiWindow*)g.WindowsPoolBlocks.back() + g.WindowsPoolBlockUsed++;
+    IM_PLACEMENT_NEW(window) ImGuiWindow(&g, name);
     window->Flags = flags;
     g.WindowsById.SetVoidPtr(window->ID, window);
 
@@ -5315,6 +6278,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
     // As we highlight the title bar when want_focus is set, multiple reappearing windows will have have their title bar highlighted on their reappearing frame.
     const float window_rounding = window->WindowRounding;
     const float window_border_size = window->WindowBorderSize;
+    window->IsOpaque = false;
     if (window->Collapsed)
     {
         // Title bar only
@@ -5340,6 +6304,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
             if (override_alpha)
                 bg_col = (bg_col & ~IM_COL32_A_MASK) | (IM_F32_TO_INT8_SAT(alpha) << IM_COL32_A_SHIFT);
             window->DrawList->AddRectFilled(window->Pos + ImVec2(0, window->TitleBarHeight()), window->Pos + window->Size, bg_col, window_rounding, (flags & ImGuiWindowFlags_NoTitleBar) ? ImDrawCornerFlags_All : ImDrawCornerFlags_Bot);
+            window->IsOpaque = ((bg_col & IM_COL32_A_MASK) == IM_COL32_A_MASK);
         }
 
         // Title bar
@@ -5347,6 +6312,8 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
         {
             ImU32 title_bar_col = GetColorU32(title_bar_is_highlight ? ImGuiCol_TitleBgActive : ImGuiCol_TitleBg);
             window->DrawList->AddRectFilled(title_bar_rect.Min, title_bar_rect.Max, title_bar_col, window_rounding, ImDrawCornerFlags_Top);
+            if ((title_bar_col & IM_COL32_A_MASK) != IM_COL32_A_MASK)
+                window->IsOpaque = false;
         }
 
         // Menu bar
@@ -5492,7 +6459,6 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
-    const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
@@ -5502,6 +6468,16 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const bool window_just_created = (window == NULL);
     if (window_just_created)
         window = CreateNewWindow(name, flags);
+    return BeginWindowEx(window, window_just_created, name, p_open, flags);
+}
+
+// Begin() after the window has been found or created. Called directly by BeginChildEx() when it already knows the window.
+bool ImGui::BeginWindowEx(ImGuiWindow* window, bool window_just_created, const char* name, bool* p_open, ImGuiWindowFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
+    IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
 
     // Automatically disable manual moving/resizing when NoInputs is set
     if ((flags & ImGuiWindowFlags_NoInputs) == ImGuiWindowFlags_NoInputs)
@@ -6019,6 +6995,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.TreeDepth = 0;
         window->DC.TreeJumpToParentOnPopMask = 0x00;
         window->DC.ChildWindows.resize(0);
+        window->DrawListsAppended.resize(0);
         window->DC.StateStorage = &window->StateStorage;
         window->DC.CurrentColumns = NULL;
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -6027,10 +7004,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         window->DC.ItemWidth = window->ItemWidthDefault;
         window->DC.TextWrapPos = -1.0f; // disabled
-        window->DC.ItemFlagsStack.resize(0);
-        window->DC.ItemWidthStack.resize(0);
-        window->DC.TextWrapPosStack.resize(0);
-        window->DC.GroupStack.resize(0);
+        window->DC.ItemFlagsStack.Reset(&g.FrameArena);
+        window->DC.ItemWidthStack.Reset(&g.FrameArena);
+        window->DC.TextWrapPosStack.Reset(&g.FrameArena);
+        window->DC.GroupStack.Reset(&g.FrameArena);
         window->DC.ItemFlags = parent_window ? parent_window->DC.ItemFlags : ImGuiItemFlags_Default_;
         if (parent_window)
             window->DC.ItemFlagsStack.push_back(window->DC.ItemFlags);
@@ -6110,6 +7087,13 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         if (style.Alpha <= 0.0f)
             window->HiddenFramesCanSkipItems = 1;
 
+        // Don't submit contents of windows which are fully covered by an opaque window (see UpdateWindowsOcclusion())
+        if (g.IO.ConfigWindowsOcclusionCulling && window->OccludedBy && IsWindowOccluded(window))
+        {
+            window->HiddenFramesCanSkipItems = 1;
+            g.WindowsOccludedCount++;
+        }
+
         // Update the Hidden flag
         window->Hidden = (window->HiddenFramesCanSkipItems > 0) || (window->HiddenFramesCannotSkipItems > 0);
 
@@ -6183,6 +7167,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
         {
             memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
             g.Windows[g.Windows.Size - 1] = window;
+            g.WindowsHotDataDirty = true;
             break;
         }
 }
@@ -6197,6 +7182,7 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
         {
             memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
             g.Windows[0] = window;
+            g.WindowsHotDataDirty = true;
             break;
         }
 }
@@ -10344,6 +11330,9 @@ static void ImeSetInputScreenPosFn_DefaultImpl(int, int) {}
 
 #ifndef IMGUI_DISABLE_METRICS_WINDOW
 
+static const char* const GAllocCategoryNames[] = { "Misc", "DrawList", "TextBuffer", "Fonts", "Windows" };
+IM_STATIC_ASSERT(IM_ARRAYSIZE(GAllocCategoryNames) == ImGuiAllocCategory_COUNT);
+
 // Avoid naming collision with imgui_demo.cpp's HelpMarker() for unity builds.
 static void MetricsHelpMarker(const char* desc)
 {
@@ -10374,7 +11363,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
-    ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
+    ImGui::Text("%d active windows (%d visible, %d occluded)", io.MetricsActiveWindows, io.MetricsRenderWindows, g.WindowsOccludedCount);
     ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
     ImGui::Separator();
 
@@ -10532,6 +11521,36 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Memory usage (recorded on every frame so the history is meaningful)
+    ImGuiMemoryStats mem_stats;
+    GetMemoryStats(&mem_stats);
+    cfg->MemoryHistory[cfg->MemoryHistoryIdx] = (float)mem_stats.GetTotalReservedBytes() / 1024.0f;
+    cfg->MemoryHistoryIdx = (cfg->MemoryHistoryIdx + 1) % IM_ARRAYSIZE(cfg->MemoryHistory);
+    if (TreeNode("Memory", "Memory (%.1f KB used, %.1f KB reserved)", (float)mem_stats.GetTotalUsedBytes() / 1024.0f, (float)mem_stats.GetTotalReservedBytes() / 1024.0f))
+    {
+        PlotLines("##MemoryHistory", cfg->MemoryHistory, IM_ARRAYSIZE(cfg->MemoryHistory), cfg->MemoryHistoryIdx, "Reserved (KB)", 0.0f, FLT_MAX, ImVec2(0.0f, GetTextLineHeight() * 4));
+        for (int n = 0; n < ImGuiMemoryCategory_COUNT; n++)
+            BulletText("%-12s %9.1f KB used, %9.1f KB reserved", GetMemoryCategoryName(n), (float)mem_stats.UsedBytes[n] / 1024.0f, (float)mem_stats.ReservedBytes[n] / 1024.0f);
+        TreePop();
+    }
+
+    // Allocations
+    if (TreeNode("Allocations", "Allocations (%d last frame)", g.DebugAllocStatsLastFrame.GetTotalCount()))
+    {
+        const ImGuiAllocStats& last_frame = g.DebugAllocStatsLastFrame;
+        const ImGuiAllocStats& total = g.DebugAllocStatsTotal;
+        Text("Active: %d allocations", g.IO.MetricsActiveAllocations);
+        Text("NoAllocAfterFrames: %d (%s)", g.IO.ConfigDebugNoAllocAfterFrames, g.DebugAllocAssertEnabled ? "armed" : "not armed");
+        if (g.IO.ConfigMemoryCompactBudget > 0)
+            Text("Memory budget: %d bytes in transient buffers, budget %d, %d buffers compacted", (int)g.GcMemoryUsage, g.IO.ConfigMemoryCompactBudget, g.GcMemoryCompactCount);
+        else
+            Text("Memory budget: disabled, %d buffers compacted", g.GcMemoryCompactCount);
+        Text("Frame arena: %d bytes used last frame (peak %d), capacity %d, grown %d times", g.FrameArena.PeakSizeLastFrame, g.FrameArena.PeakSizeEver, g.FrameArena.Capacity, g.FrameArena.OverflowCount);
+        for (int n = 0; n < ImGuiAllocCategory_COUNT; n++)
+            BulletText("%-10s last frame: %3d (%6u bytes), total: %6d (%9u bytes)", GAllocCategoryNames[n], last_frame.Count[n], (unsigned int)last_frame.Bytes[n], total.Count[n], (unsigned int)total.Bytes[n]);
+        TreePop();
+    }
+
     // Misc Details
     if (TreeNode("Internal state"))
     {
@@ -10822,6 +11841,9 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
 
     ImGuiWindowFlags flags = window->Flags;
     DebugNodeDrawList(window, window->DrawList, "DrawList");
+    if (window->WasActive)
+        for (int n = 0; n < window->DrawListsAppended.Size; n++)
+            DebugNodeDrawList(window, window->DrawListsAppended[n], "DrawListAppended");
     BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), ContentSize (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->ContentSize.x, window->ContentSize.y);
     BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
         (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
@@ -10830,6 +11852,7 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
     BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    BulletText("IsOpaque: %d, OccludedBy: '%s'", window->IsOpaque, window->OccludedBy ? window->OccludedBy->Name : "NULL");
     BulletText("NavLastIds: 0x%08X,0x%08X, NavLayerActiveMask: %X", window->NavLastIds[0], window->NavLastIds[1], window->DC.NavLayerActiveMask);
     BulletText("NavLastChildNavWindow: %s", window->NavLastChildNavWindow ? window->NavLastChildNavWindow->Name : "NULL");
     if (!window->NavRectRel[0].IsInverted())
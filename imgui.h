@@ -27,10 +27,10 @@ Index of this file:
 // ImVector<>
 // ImGuiStyle
 // ImGuiIO
-// Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
+// Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiMemoryStats)
 // Obsolete functions
-// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
-// Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeights, ImGuiPlotCache, ImGuiPlotStream, ImColor)
+// Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataSnapshot)
 // Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 
 */
@@ -114,6 +114,7 @@ Index of this file:
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataSnapshot;          // Copy of ImDrawData which stays valid after the next NewFrame(), e.g. to render a frame on another thread.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
@@ -124,17 +125,25 @@ struct ImFontConfig;                // Configuration data when adding a font or
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
+struct ImGuiComboFilter;            // Helper to filter the items of a large Combo() by prefix as you type (sorted prefix index)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store the heights of items of variable height, for ImGuiListClipper
+struct ImGuiMemoryStats;            // Memory used/reserved by a context, by category (see GetMemoryStats())
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotCache;              // Helper to plot large arrays which don't change every frame (min/max levels of detail)
+struct ImGuiPlotStream;             // Helper to plot the last N values of a live signal (ring buffer)
+struct ImGuiSelection;              // Helper to store the multi-selection of a list (ranges of items), with Selectable()
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTreeView;               // Helper to display a large tree with ImGuiListClipper (flattened list of visible nodes)
+struct ImGuiTreeViewNode;           // A node of ImGuiTreeView
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags and to not pollute the top of this file)
 // - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
@@ -145,6 +154,7 @@ typedef int ImGuiCond;              // -> enum ImGuiCond_            // Enum: A
 typedef int ImGuiDataType;          // -> enum ImGuiDataType_        // Enum: A primary data type
 typedef int ImGuiDir;               // -> enum ImGuiDir_             // Enum: A cardinal direction
 typedef int ImGuiKey;               // -> enum ImGuiKey_             // Enum: A key identifier (ImGui-side enum)
+typedef int ImGuiMemoryCategory;    // -> enum ImGuiMemoryCategory_  // Enum: A category of memory for GetMemoryStats()
 typedef int ImGuiNavInput;          // -> enum ImGuiNavInput_        // Enum: An input identifier for navigation
 typedef int ImGuiMouseButton;       // -> enum ImGuiMouseButton_     // Enum: A mouse button identifier (0=left, 1=right, 2=middle)
 typedef int ImGuiMouseCursor;       // -> enum ImGuiMouseCursor_     // Enum: A mouse cursor identifier
@@ -458,6 +468,8 @@ namespace ImGui
     IMGUI_API bool          Combo(const char* label, int* current_item, const char* const items[], int items_count, int popup_max_height_in_items = -1);
     IMGUI_API bool          Combo(const char* label, int* current_item, const char* items_separated_by_zeros, int popup_max_height_in_items = -1);      // Separate items with \0 within a string, end item-list with \0\0. e.g. "One\0Two\0Three\0"
     IMGUI_API bool          Combo(const char* label, int* current_item, bool(*items_getter)(void* data, int idx, const char** out_text), void* data, int items_count, int popup_max_height_in_items = -1);
+    IMGUI_API bool          Combo(const char* label, int* current_item, const char* const items[], int items_count, ImGuiComboFilter* filter, int popup_max_height_in_items = -1);  // With a type-ahead filter, see ImGuiComboFilter
+    IMGUI_API bool          Combo(const char* label, int* current_item, bool(*items_getter)(void* data, int idx, const char** out_text), void* data, int items_count, ImGuiComboFilter* filter, int popup_max_height_in_items = -1);
 
     // Widgets: Drag Sliders
     // - CTRL+Click on any drag box to turn them into an input box. Manually input values aren't clamped and can go off-bounds.
@@ -551,12 +563,14 @@ namespace ImGui
     IMGUI_API bool          CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags = 0);  // if returning 'true' the header is open. doesn't indent nor push on ID stack. user doesn't have to call TreePop().
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_open, ImGuiTreeNodeFlags flags = 0); // when 'p_open' isn't NULL, display an additional small close button on upper right of the header
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
+    IMGUI_API bool          TreeViewNode(ImGuiTreeView* tree, int row, const char* label, ImGuiTreeNodeFlags flags = 0); // display row 'row' of the visible nodes of a tree view, indented at the depth of its node. return true when the node is open, but doesn't push on the ID stack: don't call TreePop(). see ImGuiTreeView.
 
     // Widgets: Selectables
     // - A selectable highlights when hovered, and can display another color when selected.
     // - Neighbors selectable extend their highlight bounds in order to leave no gap between them. This is so a series of selected Selectable appear contiguous.
     IMGUI_API bool          Selectable(const char* label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
     IMGUI_API bool          Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));      // "bool* p_selected" point to the selection state (read-write), as a convenient helper.
+    IMGUI_API bool          Selectable(const char* label, ImGuiSelection* selection, int item_idx, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // item 'item_idx' of a multi-selection: click, Ctrl+Click, Shift+Click, Shift+Arrows. return true when the selection changed. see ImGuiSelection.
 
     // Widgets: List Boxes
     // - FIXME: To be consistent with all the newer API, ListBoxHeader/ListBoxFooter should in reality be called BeginListBox/EndListBox. Will rename them.
@@ -567,9 +581,18 @@ namespace ImGui
     IMGUI_API void          ListBoxFooter();                                                    // terminate the scrolling region. only call ListBoxFooter() if ListBoxHeader() returned true!
 
     // Widgets: Data Plotting
+    // - Arrays with more values than pixels are drawn as the min/max envelope of the values in each pixel column, so peaks are never lost. This reads every value.
+    // - For large arrays which don't change every frame, build an ImGuiPlotCache and use PlotLinesCached(): plotting draws the same envelope in O(graph width) instead of O(values_count).
+    // - For live signals, add values to an ImGuiPlotStream: it owns a ring buffer and keeps its statistics up to date as values are added.
     IMGUI_API void          PlotLines(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
+    IMGUI_API void          PlotLinesDouble(const char* label, const double* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(double));
+    IMGUI_API void          PlotLinesCached(const char* label, const ImGuiPlotCache* cache, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, ImGuiPlotStream* stream, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
+    IMGUI_API void          PlotHistogramDouble(const char* label, const double* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(double));
+    IMGUI_API void          PlotHistogramCached(const char* label, const ImGuiPlotCache* cache, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotHistogram(const char* label, ImGuiPlotStream* stream, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
 
     // Widgets: Value() Helpers.
@@ -777,6 +800,8 @@ namespace ImGui
 
     // Debug Utilities
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
+    IMGUI_API void          GetMemoryStats(ImGuiMemoryStats* out_stats);                        // compute bytes used/reserved by the current context, by category. Walks all windows, fonts, tab bars etc. so call it on demand rather than every frame.
+    IMGUI_API const char*   GetMemoryCategoryName(ImGuiMemoryCategory category);                // get a string corresponding to the enum value (for display, logging, etc.).
 
     // Memory Allocators
     // - All those functions are not reliant on the current context.
@@ -1346,6 +1371,22 @@ enum ImGuiCond_
     ImGuiCond_Appearing     = 1 << 3    // Set the variable if the object/window is appearing after being hidden/inactive (or the first time)
 };
 
+// Enumeration for GetMemoryStats()
+// Note that the font atlas may be shared by multiple contexts, in which case it is reported by each of them.
+enum ImGuiMemoryCategory_
+{
+    ImGuiMemoryCategory_Windows,        // ImGuiWindow structures, names, ID stacks, state storage, window lists
+    ImGuiMemoryCategory_DrawLists,      // ImDrawList command/index/vertex buffers, paths and stacks (windows, background and foreground)
+    ImGuiMemoryCategory_DrawChannels,   // ImDrawListSplitter channels (windows and columns)
+    ImGuiMemoryCategory_Fonts,          // Font atlas textures, TTF data, glyphs and lookup tables
+    ImGuiMemoryCategory_Settings,       // .ini settings data and handlers
+    ImGuiMemoryCategory_InputText,      // Text input state buffers
+    ImGuiMemoryCategory_TabBars,        // Tab bars and their tabs
+    ImGuiMemoryCategory_Columns,        // Columns sets
+    ImGuiMemoryCategory_Other,          // Frame arena, draw data lists
+    ImGuiMemoryCategory_COUNT
+};
+
 //-----------------------------------------------------------------------------
 // Helpers: Memory allocations macros
 // IM_MALLOC(), IM_FREE(), IM_NEW(), IM_PLACEMENT_NEW(), IM_DELETE()
@@ -1524,7 +1565,10 @@ struct ImGuiIO
     bool        ConfigInputTextCursorBlink;     // = true           // Set to false to disable blinking cursor, for users who consider it distracting. (was called: io.OptCursorBlink prior to 1.63)
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
+    bool        ConfigWindowsOcclusionCulling;  // = false          // [BETA] Don't render windows fully covered by a single opaque window. If the covering window was submitted before them in the frame and still covers them, Begin() also returns false (their contents are skipped) while they stay alive and keep their size. Submit the windows covering others first to benefit from it.
     float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused. Set to -1.0f to disable.
+    int         ConfigMemoryCompactBudget;      // = 0              // [BETA] When transient buffers (window draw lists, ID stacks, columns, text input) hold more than this many bytes, compact least recently used windows then over-reserved buffers. Set to 0 to disable.
+    int         ConfigDebugNoAllocAfterFrames;  // = -1             // [DEBUG] Assert on any call to MemAlloc() once this many frames have been completed, to verify that your UI reaches a zero-allocation steady state. See Metrics window for a breakdown. Set to -1 to disable.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1589,6 +1633,7 @@ struct ImGuiIO
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
     int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsFrameAllocations;        // Number of calls to MemAlloc() during the last frame, based on current context.
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -1693,6 +1738,17 @@ struct ImGuiPayload
     bool IsDelivery() const                 { return Delivery; }
 };
 
+// Memory report for a context, by category: GetMemoryStats()
+struct ImGuiMemoryStats
+{
+    size_t  UsedBytes[ImGuiMemoryCategory_COUNT];       // Bytes holding actual data
+    size_t  ReservedBytes[ImGuiMemoryCategory_COUNT];   // Bytes allocated, including unused capacity of buffers. >= UsedBytes.
+
+    ImGuiMemoryStats()                      { memset(this, 0, sizeof(*this)); }
+    size_t  GetTotalUsedBytes() const       { size_t n = 0; for (int i = 0; i < ImGuiMemoryCategory_COUNT; i++) n += UsedBytes[i]; return n; }
+    size_t  GetTotalReservedBytes() const   { size_t n = 0; for (int i = 0; i < ImGuiMemoryCategory_COUNT; i++) n += ReservedBytes[i]; return n; }
+};
+
 //-----------------------------------------------------------------------------
 // Obsolete functions (Will be removed! Read 'API BREAKING CHANGES' section in imgui.cpp for details)
 // Please keep your copy of dear imgui up to date! Occasionally set '#define IMGUI_DISABLE_OBSOLETE_FUNCTIONS' in imconfig.h to stay ahead.
@@ -1784,6 +1840,26 @@ struct ImGuiTextFilter
     int                     CountGrep;
 };
 
+// Helper: Type-ahead filter for the items of a large Combo(), e.g. a list of 1M symbols.
+// Keeps a prefix index: the items sorted by case-insensitive text, so the items starting with the typed text are a contiguous
+// range of it, found with a binary search. Opening, filtering and scrolling the combo are then O(visible items).
+// Call Build() before passing the filter to Combo(), and again when the items change. It is O(N log N) (about a second for 1M items),
+// so call it when loading the items rather than on the frame the combo opens. Combo() asserts and ignores a filter built for another items count.
+struct ImGuiComboFilter
+{
+    char                InputBuf[256];
+    ImVector<int>       SortedItems;    // Item indices sorted by text (case-insensitive)
+    int                 MatchBegin;     // Range of SortedItems[] starting with InputBuf
+    int                 MatchEnd;
+
+    ImGuiComboFilter()                  { InputBuf[0] = 0; MatchBegin = MatchEnd = 0; }
+    IMGUI_API void      Build(const char* const items[], int items_count);
+    IMGUI_API void      Build(bool (*items_getter)(void* data, int idx, const char** out_text), void* data, int items_count);  // The getter must return pointers which stay valid during Build().
+    IMGUI_API void      Search(bool (*items_getter)(void* data, int idx, const char** out_text), void* data);                 // Update MatchBegin/MatchEnd from InputBuf. O(log N).
+    void                Clear()         { InputBuf[0] = 0; SortedItems.clear(); MatchBegin = MatchEnd = 0; }
+    bool                IsActive() const { return InputBuf[0] != 0; }
+};
+
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
 struct ImGuiTextBuffer
@@ -1873,6 +1949,16 @@ struct ImGuiStorage
 // - Clipper can measure the height of the first element
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
+// For items of variable height, keep an ImGuiListClipperHeights alongside your list and pass it to Begin():
+//   static ImGuiListClipperHeights heights;
+//   ImGuiListClipper clipper;
+//   clipper.Begin(1000, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", my_paragraphs[i]);
+// - Clipper finds the first visible item from the stored heights and positions the cursor before it.
+// - Clipper lets you process one element at a time, measures it, and stops after the last visible element.
+// - Items which haven't been submitted yet are assumed to be heights.DefaultHeight high, the scrollbar adjusts as they get measured.
 struct ImGuiListClipper
 {
     int     DisplayStart;
@@ -1883,6 +1969,9 @@ struct ImGuiListClipper
     int     StepNo;
     float   ItemsHeight;
     float   StartPosY;
+    ImGuiListClipperHeights* Heights;   // Variable heights mode: measured heights of items
+    float   ItemPosY;                   // Variable heights mode: position of the current item
+    float   EndPosY;                    // Variable heights mode: stop after the item crossing this position
 
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
@@ -1890,14 +1979,181 @@ struct ImGuiListClipper
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API void Begin(int items_count, float items_height = -1.0f);  // Automatically called by constructor if you passed 'items_count' or by Step() in Step 1.
+    IMGUI_API void Begin(int items_count, ImGuiListClipperHeights* heights); // Items of variable height. The heights are resized to 'items_count'.
     IMGUI_API void End();                                               // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool Step();                                              // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
+    IMGUI_API void ScrollToItem(int item_idx, float center_y_ratio = 0.5f); // Call after Begin() to scroll to an item which may not be submitted. Requires a known items_height or heights.
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     inline ImGuiListClipper(int items_count, float items_height = -1.0f) { memset(this, 0, sizeof(*this)); ItemsCount = -1; Begin(items_count, items_height); } // [removed in 1.79]
 #endif
 };
 
+// Helper: Heights of the items of a list of variable item heights (e.g. expandable rows, wrapped text), for ImGuiListClipper.
+// The clipper measures the items it lets you submit. Their sums are kept in a Fenwick tree, so updating the height of an item,
+// getting its offset from the top of the list and finding the item at a given offset are all O(log items_count).
+// Keep it as long as your list: heights are indexed by item, call SetHeight()/Clear() if the heights of items change without being submitted.
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;        // Height of each item, including item spacing
+    ImVector<double>    Sums;           // Fenwick tree: Sums[n - 1] is the sum of Heights[n - (n & -n)] to Heights[n - 1]
+    float               DefaultHeight;  // Height of items which haven't been measured yet. Default to GetTextLineHeightWithSpacing() on first use.
+
+    ImGuiListClipperHeights()   { DefaultHeight = 0.0f; }
+    IMGUI_API void      Resize(int items_count);                            // New items get DefaultHeight
+    IMGUI_API void      Clear();                                            // Forget all heights
+    IMGUI_API void      SetHeight(int item_idx, float height);
+    float               GetHeight(int item_idx) const   { return Heights[item_idx]; }
+    IMGUI_API float     GetOffset(int item_idx) const;                      // Sum of the heights of items before 'item_idx'
+    float               GetTotalHeight() const          { return GetOffset(Heights.Size); }
+    IMGUI_API int       FindItem(float offset) const;                       // Index of the item at 'offset' from the top of the list, clamped to [0, items_count - 1]
+};
+
+// Helper: Multi-selection of the items of a list, by index, for Selectable(label, ImGuiSelection*, item_idx).
+// Stores the selection as sorted ranges of items: selecting all or a Shift+Click range of 10M items adds a single range,
+// Contains() is a binary search, and SetRange() is a binary search plus moving the ranges after it.
+// - Click: select the item. Ctrl+Click: toggle it. Shift+Click, Shift+Up/Down: select the range from the last clicked item.
+// - Ctrl+A: select all. Drag from empty space of the list: box-select the items crossed by the box (hold Ctrl to add to the selection).
+//   Box-select uses the geometry of the clipper, so items which are clipped while dragging and scrolling are selected too.
+// Usage:
+//   static ImGuiSelection selection;
+//   ImGuiListClipper clipper;
+//   clipper.Begin(items_count, ImGui::GetTextLineHeightWithSpacing());  // Requires a known items height, or ImGuiListClipperHeights
+//   selection.Update(&clipper);                                         // Ctrl+A and box-select, after Begin() and before Step()
+//   while (clipper.Step())
+//       for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+//           ImGui::Selectable(my_labels[n], &selection, n);
+//   for (int n = 0; n < selection.Ranges.Size; n++) { ... }             // Iterate the selection
+struct ImGuiSelection
+{
+    struct Range { int Begin, End; };           // Items [Begin, End)
+
+    ImVector<Range>     Ranges;                 // Sorted, not overlapping nor adjacent
+    int                 Count;                  // Number of selected items
+    int                 AnchorIdx;              // Last clicked item: start of Shift+Click ranges, -1 if none
+
+    // [Internal] Box-select
+    bool                BoxSelectActive;
+    ImVec2              BoxSelectStartPos;      // Relative to the first item, so it follows scrolling
+    ImVector<Range>     BoxSelectBackupRanges;  // Selection to add the box to, when Ctrl was held
+    int                 BoxSelectBackupCount;
+    ImVec2              BoxSelectItemsX;        // Horizontal extent (min, max) of the items submitted during the last frame, relative to the window contents
+    ImVec2              BoxSelectItemsXNext;
+
+    ImGuiSelection()    { Count = 0; AnchorIdx = -1; BoxSelectActive = false; BoxSelectBackupCount = 0; BoxSelectItemsX = BoxSelectItemsXNext = ImVec2(FLT_MAX, -FLT_MAX); }
+    IMGUI_API bool      Contains(int item_idx) const;                       // O(log ranges)
+    IMGUI_API void      SetRange(int item_begin, int item_end, bool selected); // Select/unselect items [item_begin, item_end)
+    void                SetSelected(int item_idx, bool selected)    { SetRange(item_idx, item_idx + 1, selected); }
+    void                Clear()                                     { Ranges.resize(0); Count = 0; }
+    void                SelectAll(int items_count)                  { Clear(); SetRange(0, items_count, true); }
+    IMGUI_API void      ApplyClick(int item_idx, bool ctrl, bool shift);    // What Selectable() does on click
+    IMGUI_API void      Update(const ImGuiListClipper* clipper);            // Handle Ctrl+A and box-select. Call after ImGuiListClipper::Begin(), before Step().
+};
+
+// Helper: Display a large tree (e.g. 1M nodes) with ImGuiListClipper.
+// TreeNode() hierarchies can't be clipped, as each open node needs its parents to be submitted. Instead the tree view keeps
+// the flattened list of its visible nodes (root nodes, and children of open nodes, in display order), which is updated
+// incrementally when a node opens or closes, for the cost of the rows added or removed. Open states are stored in the nodes.
+// Usage:
+//   static ImGuiTreeView tree;
+//   if (tree.Nodes.empty())
+//       for (...) tree.AddNode(parent_node_idx);      // Return the node index, use it to find your data
+//   tree.Update();                                     // Once per frame, before the clipper: apply open/close of the previous frame
+//   ImGuiListClipper clipper;
+//   clipper.Begin(tree.VisibleNodes.Size);
+//   while (clipper.Step())
+//       for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+//           ImGui::TreeViewNode(&tree, row, my_labels[tree.VisibleNodes[row]]);
+struct ImGuiTreeViewNode
+{
+    int                 Parent;             // -1 for root nodes
+    int                 FirstChild;         // -1 if the node has no children
+    int                 LastChild;
+    int                 NextSibling;        // -1 for the last child
+    int                 Depth;              // 0 for root nodes
+    bool                Open;
+};
+
+struct ImGuiTreeView
+{
+    struct OpenRequest { int NodeIdx; int Row; bool Open; };
+
+    ImVector<ImGuiTreeViewNode> Nodes;
+    ImVector<int>       VisibleNodes;       // Flattened list of visible nodes, in display order. Index with the clipper rows.
+    int                 FirstRoot;          // -1 when empty
+    int                 LastRoot;
+    bool                VisibleNodesDirty;  // Nodes were added: rebuild VisibleNodes in Update()
+    int                 UpdateFrame;
+    ImVector<OpenRequest> Requests;         // Nodes opened/closed by TreeViewNode() this frame
+    ImVector<int>       TempNodes;
+    ImGuiStorage        TempStorage;        // Open state of the current node, exposed to TreeNodeBehavior()
+
+    ImGuiTreeView()     { FirstRoot = LastRoot = -1; VisibleNodesDirty = false; UpdateFrame = -1; }
+    IMGUI_API int       AddNode(int parent_node_idx, bool open = false);    // Return the node index. Children are listed in the order they are added.
+    IMGUI_API void      Clear();
+    IMGUI_API void      Update();                                           // Apply changes to VisibleNodes. Call once per frame before ImGuiListClipper::Begin().
+    IMGUI_API void      SetNodeOpen(int node_idx, bool open);               // Open/close a node, updating VisibleNodes. Don't call while iterating VisibleNodes.
+    IMGUI_API void      SetAllNodesOpen(bool open);                         // Open/close all nodes, rebuilding VisibleNodes in Update(). O(nodes).
+    IMGUI_API bool      IsNodeVisible(int node_idx) const;                  // Are all the parents of the node open?
+    IMGUI_API int       FindRow(int node_idx) const;                        // Row of a visible node, -1 otherwise. O(rows).
+};
+
+// Helper: Min/max levels of detail to plot large arrays which don't change every frame, with PlotLinesCached()/PlotHistogramCached().
+// Call Build() again after modifying the values. They are not copied: they must stay valid while the cache is used.
+// Usage:
+//   static ImGuiPlotCache cache;
+//   if (values_changed)
+//       cache.Build(values, values_count);
+//   ImGui::PlotLinesCached("Telemetry", &cache);
+struct ImGuiPlotCache
+{
+    const void*         Values;             // Source values (not owned)
+    int                 ValuesCount;
+    int                 Stride;
+    ImGuiDataType       DataType;           // ImGuiDataType_Float or ImGuiDataType_Double
+    ImVector<ImVec2>    Levels;             // Min (x) and max (y) of blocks of 8, 64, 512... values, one level after the other
+    ImVector<int>       LevelsOffsets;      // Index of the first block of each level in Levels[]
+
+    ImGuiPlotCache()    { Values = NULL; ValuesCount = Stride = 0; DataType = ImGuiDataType_Float; }
+    IMGUI_API void      Build(const float* values, int values_count, int stride = sizeof(float));
+    IMGUI_API void      Build(const double* values, int values_count, int stride = sizeof(double));
+    IMGUI_API void      Clear();
+    IMGUI_API void      Update(int idx_begin, int idx_end);     // Call after modifying the values in [idx_begin, idx_end), instead of a full Build(). O(count + log(values_count)).
+    IMGUI_API void      GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const; // Min/max of values in [idx_begin, idx_end), ignoring NaN. FLT_MAX/-FLT_MAX if there are none.
+};
+
+// Helper: Ring buffer keeping the last N values of a live signal, to plot with PlotLines()/PlotHistogram().
+// Adding values updates the min/max of the buffer (used for auto-scaling) and its levels of detail incrementally, in O(log N) per value.
+// The min/max of each pixel column is kept in the stream until it scrolls out, so plotting only computes the columns which scrolled in.
+// Usage:
+//   static ImGuiPlotStream stream(10000);       // Keep the last 10000 values
+//   stream.AddValues(new_samples, new_samples_count);
+//   ImGui::PlotLines("Channel 0", &stream);
+struct ImGuiPlotStream
+{
+    ImVector<float>     Values;             // Ring buffer of GetCapacity() values. The most recent one is Values[(TotalCount - 1) % GetCapacity()].
+    ImS64               TotalCount;         // Number of values added since Clear()
+    ImGuiPlotCache      Cache;              // Levels of detail of Values[]
+    ImVector<int>       MinQueue;           // [Internal] Monotonic queues of indices in Values[] (ring buffers): increasing values in MinQueue, decreasing values in MaxQueue.
+    ImVector<int>       MaxQueue;           // [Internal] The front of each queue is the min/max of the buffer.
+    int                 MinQueueFront, MinQueueSize;
+    int                 MaxQueueFront, MaxQueueSize;
+    ImVector<ImS64>     ColumnsIdx;         // [Internal] Min/max of the last plotted pixel columns, indexed by absolute column index modulo the number of entries.
+    ImVector<ImVec2>    ColumnsMinMax;      // [Internal] Plotting a stream several times per frame with different widths defeats this cache.
+    int                 ColumnsValuesCount; // [Internal] Number of values per column of ColumnsMinMax[]
+
+    ImGuiPlotStream(int capacity = 0)   { TotalCount = 0; MinQueueFront = MinQueueSize = MaxQueueFront = MaxQueueSize = ColumnsValuesCount = 0; if (capacity > 0) SetCapacity(capacity); }
+    IMGUI_API void      SetCapacity(int capacity);                      // Also clear the stream
+    IMGUI_API void      Clear();
+    IMGUI_API void      AddValues(const float* values, int values_count);
+    void                AddValue(float value)   { AddValues(&value, 1); }
+    int                 GetCapacity() const     { return Values.Size; }
+    int                 GetSize() const         { return (TotalCount < Values.Size) ? (int)TotalCount : Values.Size; }
+    int                 GetOffset() const       { return (TotalCount < Values.Size) ? 0 : (int)(TotalCount % Values.Size); } // Index of the oldest value in Values[]
+    float               GetMin() const          { return (MinQueueSize > 0) ? Values.Data[MinQueue.Data[MinQueueFront]] : FLT_MAX; }  // Min/max of the values in the buffer, ignoring NaN. O(1).
+    float               GetMax() const          { return (MaxQueueSize > 0) ? Values.Data[MaxQueue.Data[MaxQueueFront]] : -FLT_MAX; }
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -1939,7 +2195,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataSnapshot)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -2196,6 +2452,37 @@ struct ImDrawData
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
+// Snapshot of a ImDrawData, stored in draw lists owned by the snapshot, which stays valid after the next NewFrame().
+// This is useful to render frame N on another thread while building frame N+1 (see misc/cpp/imgui_threaded_rendering.h for a triple buffer).
+// - SwapFrom() takes the command/index/vertex buffers of the source draw lists and gives them this snapshot's previous buffers.
+//   Nothing is copied, and once buffers have grown, nothing is allocated. The source ImDrawData is cleared (Valid == false) and the
+//   source draw lists are emptied, so don't render the source after this. Call it after Render() and before the next NewFrame().
+// - CopyFrom() copies the buffers into this snapshot's storage, leaving the source untouched.
+// - The snapshot keeps one draw list per source draw list, so buffer capacities follow the same window from frame to frame.
+//   Draw lists whose source hasn't been seen for a while are freed.
+// Ownership: a snapshot belongs to whoever holds it. Fill it on the UI thread, hand it over to the render thread, which reads
+// 'DrawData', and don't touch it from the UI thread again until the render thread has handed it back.
+struct ImDrawDataSnapshot
+{
+    ImDrawData              DrawData;           // Render this. DrawData.CmdLists points to draw lists owned by the snapshot.
+
+    ImDrawDataSnapshot()    { _UpdateCount = 0; }
+    ~ImDrawDataSnapshot()   { Clear(); }
+    IMGUI_API void          SwapFrom(ImDrawData* src);
+    IMGUI_API void          CopyFrom(const ImDrawData* src);
+    IMGUI_API void          Clear();            // Free all memory
+
+    // [Internal]
+    ImVector<ImDrawList*>   _CmdLists;          // Storage for DrawData.CmdLists
+    ImVector<ImDrawList*>   _Lists;             // Draw lists owned by the snapshot
+    ImVector<ImDrawList*>   _ListsSource;       // Source draw list for each entry of _Lists[] (only used as a key, never dereferenced)
+    ImVector<int>           _ListsLastUsed;     // Value of _UpdateCount when each entry of _Lists[] was last used
+    ImGuiStorage            _ListsMap;          // Hashed source draw list pointer -> index in _Lists[]
+    int                     _UpdateCount;       // Number of calls to SwapFrom()/CopyFrom()
+    IMGUI_API ImDrawList*   _AddListForSource(ImDrawList* src_list);
+    IMGUI_API void          _EndUpdate(const ImDrawData* src);
+};
+
 //-----------------------------------------------------------------------------
 // Font API (ImFontConfig, ImFontGlyph, ImFontAtlasFlags, ImFontAtlas, ImFontGlyphRangesBuilder, ImFont)
 //-----------------------------------------------------------------------------
@@ -2292,6 +2579,11 @@ enum ImFontAtlasFlags_
 // - Important: By default, AddFontFromMemoryTTF() takes ownership of the data. Even though we are not writing to it, we will free the pointer on destruction.
 //   You can set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed,
 // - Even though many functions are suffixed with "TTF", OTF data is supported just as well.
+// Sharing a font atlas:
+// - Multiple contexts can share an atlas by passing it to CreateContext(). Each NewFrame() locks it until EndFrame() so modifications will assert.
+// - To use a shared atlas from contexts running on different threads (see IMGUI_USE_THREAD_LOCAL_CONTEXT): add fonts, Build() or call the
+//   GetTexData*** function your backend uses, upload the texture and call SetTexID(), then set 'Locked = true' before starting the threads.
+//   Contexts leave an atlas locked by the user untouched and only read from it. Clear 'Locked' only once no thread is using it.
 // - This is an old API and it is currently awkward for those and and various other reasons! We will address them in the future!
 struct ImFontAtlas
 {
@@ -2357,7 +2649,7 @@ struct ImFontAtlas
     // Members
     //-------------------------------------------
 
-    bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert. Set it yourself to share the atlas between threads.
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
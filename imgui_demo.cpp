@@ -781,6 +781,53 @@ static void ShowDemoWindowWidgets()
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+
+        if (ImGui::TreeNode("Large tree (clipped)"))
+        {
+            // A tree of 10 x 100 x 1000 nodes: TreeNode() would need to submit every open node, ImGuiTreeView
+            // keeps the flattened list of visible nodes so rows can be clipped with ImGuiListClipper.
+            static ImGuiTreeView tree;
+            static int selected_node = -1;
+            if (tree.Nodes.empty())
+                for (int i = 0; i < 10; i++)
+                {
+                    int node_i = tree.AddNode(-1, i == 0);
+                    for (int j = 0; j < 100; j++)
+                    {
+                        int node_j = tree.AddNode(node_i);
+                        for (int k = 0; k < 1000; k++)
+                            tree.AddNode(node_j);
+                    }
+                }
+            tree.Update();
+            ImGui::Text("%d nodes, %d visible", tree.Nodes.Size, tree.VisibleNodes.Size);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Expand all"))
+                tree.SetAllNodesOpen(true);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Collapse all"))
+                tree.SetAllNodesOpen(false);
+
+            ImGui::BeginChild("##tree", ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing() * 12), true);
+            ImGuiListClipper clipper;
+            clipper.Begin(tree.VisibleNodes.Size);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    const int node_n = tree.VisibleNodes[row];
+                    const int depth = tree.Nodes[node_n].Depth;
+                    char label[32];
+                    sprintf(label, "%s %d", depth == 0 ? "Group" : depth == 1 ? "Folder" : "Item", node_n);
+                    ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanAvailWidth;
+                    if (node_n == selected_node)
+                        node_flags |= ImGuiTreeNodeFlags_Selected;
+                    ImGui::TreeViewNode(&tree, row, label, node_flags);
+                    if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen())
+                        selected_node = node_n;
+                }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 
@@ -1011,6 +1058,28 @@ static void ShowDemoWindowWidgets()
         static int item_current_4 = 0;
         ImGui::Combo("combo 4 (function)", &item_current_4, &Funcs::ItemGetter, items, IM_ARRAYSIZE(items));
 
+        // Large lists: Combo() only submits the visible items. An ImGuiComboFilter adds a type-ahead filter using a sorted prefix index.
+        static ImVector<char> symbols_buf;
+        static ImVector<const char*> symbols;
+        static ImGuiComboFilter symbols_filter;
+        static int item_current_5 = 0;
+        if (symbols.empty())
+        {
+            const char* syllables[] = { "ka", "lo", "mi", "ne", "ru", "sa", "to", "vi", "ba", "de", "fu", "go", "hi", "ju", "pe", "zo" };
+            const int symbols_count = 100000;
+            symbols_buf.resize(symbols_count * 16);
+            symbols.resize(symbols_count);
+            char* p = symbols_buf.Data;
+            for (int n = 0; n < symbols_count; n++)
+            {
+                symbols[n] = p;
+                p += sprintf(p, "%s%s%s%s_%d", syllables[n % 16], syllables[(n / 16) % 16], syllables[(n / 256) % 16], syllables[(n / 4096) % 16], n) + 1;
+            }
+            symbols_filter.Build(symbols.Data, symbols.Size);
+        }
+        ImGui::Combo("combo 5 (100000 items, filter)", &item_current_5, symbols.Data, symbols.Size, &symbols_filter);
+        ImGui::SameLine(); HelpMarker("Type the start of a name to filter the items, e.g. \"kalo\". Enter selects the first match.");
+
         ImGui::TreePop();
     }
 
@@ -1063,6 +1132,32 @@ static void ShowDemoWindowWidgets()
             }
             ImGui::TreePop();
         }
+        if (ImGui::TreeNode("Selection State: Multiple Selection (1M items)"))
+        {
+            HelpMarker(
+                "ImGuiSelection stores the selection as ranges of items, so it stays small whatever is selected.\n"
+                "CTRL+Click: toggle. SHIFT+Click, SHIFT+Up/Down: select range. CTRL+A: select all.\n"
+                "Drag from the empty space on the right of the items: box-select, scrolling when dragging out of the list.");
+            static ImGuiSelection selection;
+            const int items_count = 1000000;
+            ImGui::Text("%d selected items, %d ranges", selection.Count, selection.Ranges.Size);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Clear"))
+                selection.Clear();
+            ImGui::BeginChild("##items", ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing() * 12), true);
+            ImGuiListClipper clipper;
+            clipper.Begin(items_count, ImGui::GetTextLineHeightWithSpacing());
+            selection.Update(&clipper);
+            while (clipper.Step())
+                for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                {
+                    char buf[32];
+                    sprintf(buf, "Object %d", n);
+                    ImGui::Selectable(buf, &selection, n, 0, ImVec2(ImGui::GetFontSize() * 12, 0.0f));
+                }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         if (ImGui::TreeNode("Rendering more text into the same line"))
         {
             // Using the Selectable() override that takes "bool* p_selected" parameter,
@@ -1365,6 +1460,36 @@ static void ShowDemoWindowWidgets()
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::Separator();
 
+        // Large arrays: when there are more values than pixels, each pixel column shows the min/max of its values so peaks are never lost.
+        // An ImGuiPlotCache makes the cost of plotting an array which doesn't change every frame independent of its size.
+        static ImVector<float> large_values;
+        static ImGuiPlotCache large_values_cache;
+        if (large_values.empty())
+        {
+            large_values.resize(100000);
+            for (int n = 0; n < large_values.Size; n++)
+                large_values[n] = sinf(n * 0.0005f) + ((n % 9973 == 0) ? 1.5f : 0.0f); // Add a few single-value spikes
+            large_values_cache.Build(large_values.Data, large_values.Size);
+        }
+        ImGui::PlotLinesCached("100000 values", &large_values_cache, 0, NULL, -1.0f, 2.5f, ImVec2(0, 80));
+
+        // Live signals: an ImGuiPlotStream keeps the last N values and updates its statistics as values are added,
+        // here simulating a 10 kHz signal (so ~166 new values per frame at 60 FPS).
+        static ImGuiPlotStream stream(20000);
+        static double stream_time = 0.0;
+        if (animate || stream.TotalCount == 0)
+        {
+            float new_values[512];
+            int new_values_count = IM_MIN((int)(ImGui::GetIO().DeltaTime * 10000.0f) + 1, (int)IM_ARRAYSIZE(new_values));
+            for (int n = 0; n < new_values_count; n++, stream_time += 1.0 / 10000.0)
+                new_values[n] = sinf((float)stream_time * 3.0f) * (1.0f + 0.5f * sinf((float)stream_time * 0.3f)) + (((stream.TotalCount + n) % 7919 == 0) ? 0.8f : 0.0f);
+            stream.AddValues(new_values, new_values_count);
+        }
+        char stream_overlay[48];
+        sprintf(stream_overlay, "min %.3f, max %.3f", stream.GetMin(), stream.GetMax());
+        ImGui::PlotLines("Stream", &stream, stream_overlay, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        ImGui::Separator();
+
         // Animate a simple progress bar
         static float progress = 0.0f, progress_dir = 1.0f;
         if (animate)
@@ -4568,6 +4693,7 @@ static void ShowExampleAppConsole(bool* p_open)
 // [SECTION] Example App: Debug Log / ShowExampleAppLog()
 //-----------------------------------------------------------------------------
 
+// For millions of lines or appending from other threads, see ImGuiLogConsole in misc/cpp/imgui_log_console.h.
 // Usage:
 //  static ExampleAppLog my_log;
 //  my_log.AddLog("Hello %d world\n", 123);
@@ -4885,7 +5011,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to Text(), variable heights, clipped\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -4895,6 +5022,18 @@ static void ShowExampleAppLongText(bool* p_open)
             log.appendf("%i The quick brown fox jumps over the lazy dog\n", lines + i);
         lines += 1000;
     }
+    static int scroll_to_line = 0;
+    static bool scroll_to_line_request = false;
+    if (test_type == 3)
+    {
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        if (ImGui::InputInt("##Line", &scroll_to_line, 0, 0, ImGuiInputTextFlags_EnterReturnsTrue))
+            scroll_to_line_request = true;
+        ImGui::SameLine();
+        if (ImGui::Button("Scroll to line"))
+            scroll_to_line_request = true;
+    }
     ImGui::BeginChild("Log");
     switch (test_type)
     {
@@ -4921,7 +5060,29 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Items of variable height: the clipper measures the items it lets us submit and stores their heights.
+            // Lines which have never been visible are assumed to have the default height.
+            static ImGuiListClipperHeights heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.Begin(lines, &heights);
+            if (scroll_to_line_request && lines > 0)
+                clipper.ScrollToItem(IM_MAX(0, IM_MIN(scroll_to_line, lines - 1)), 0.0f);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if ((i % 7) == 0)
+                        ImGui::Text("%i The quick brown fox\n  jumps over\n  the lazy dog", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+                }
+            ImGui::PopStyleVar();
+            break;
+        }
     }
+    scroll_to_line_request = false;
     ImGui::EndChild();
     ImGui::End();
 }
@@ -10,6 +10,7 @@ Index of this file:
 // [SECTION] ImDrawList
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDataSnapshot
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas
@@ -415,6 +416,7 @@ void ImDrawList::_ClearFreeMemory()
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_DrawList);
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
@@ -432,6 +434,11 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+    if (CmdBuffer.Size == CmdBuffer.Capacity)
+    {
+        ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_DrawList);
+        CmdBuffer.reserve(CmdBuffer._grow_capacity(CmdBuffer.Size + 1));
+    }
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -593,10 +600,19 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
+    int idx_buffer_old_size = IdxBuffer.Size;
+    if (vtx_buffer_old_size + vtx_count > VtxBuffer.Capacity || idx_buffer_old_size + idx_count > IdxBuffer.Capacity)
+    {
+        ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_DrawList);
+        if (vtx_buffer_old_size + vtx_count > VtxBuffer.Capacity)
+            VtxBuffer.reserve(VtxBuffer._grow_capacity(vtx_buffer_old_size + vtx_count));
+        if (idx_buffer_old_size + idx_count > IdxBuffer.Capacity)
+            IdxBuffer.reserve(IdxBuffer._grow_capacity(idx_buffer_old_size + idx_count));
+    }
+
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
 
-    int idx_buffer_old_size = IdxBuffer.Size;
     IdxBuffer.resize(idx_buffer_old_size + idx_count);
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
@@ -1427,6 +1443,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_DrawList);
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
         _Channels.resize(channels_count);
@@ -1462,6 +1479,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     if (_Count <= 1)
         return;
 
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_DrawList);
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
@@ -1588,6 +1606,126 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataSnapshot
+//-----------------------------------------------------------------------------
+
+// Free draw lists whose source draw list hasn't been part of the last N updates (e.g. window which is not visible anymore).
+static const int DRAWDATA_SNAPSHOT_GC_UPDATES = 60;
+
+// Copy preserving the destination capacity (unlike ImVector<>::operator= which frees it)
+template<typename T>
+static void ImVectorCopyPreserveCapacity(ImVector<T>& dst, const ImVector<T>& src)
+{
+    dst.resize(src.Size);
+    if (src.Size > 0)
+        memcpy(dst.Data, src.Data, (size_t)src.Size * sizeof(T));
+}
+
+void ImDrawDataSnapshot::SwapFrom(ImDrawData* src)
+{
+    IM_ASSERT(src->Valid && "Call after Render() and before the next NewFrame()");
+    _UpdateCount++;
+    _CmdLists.resize(0);
+    for (int n = 0; n < src->CmdListsCount; n++)
+    {
+        ImDrawList* src_list = src->CmdLists[n];
+        ImDrawList* dst_list = _AddListForSource(src_list);
+        dst_list->CmdBuffer.swap(src_list->CmdBuffer);
+        dst_list->IdxBuffer.swap(src_list->IdxBuffer);
+        dst_list->VtxBuffer.swap(src_list->VtxBuffer);
+        src_list->_ResetForNewFrame(); // Leave source in a valid, empty state
+    }
+    _EndUpdate(src);
+    src->Clear();
+}
+
+void ImDrawDataSnapshot::CopyFrom(const ImDrawData* src)
+{
+    IM_ASSERT(src->Valid && "Call after Render() and before the next NewFrame()");
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_DrawList);
+    _UpdateCount++;
+    _CmdLists.resize(0);
+    for (int n = 0; n < src->CmdListsCount; n++)
+    {
+        const ImDrawList* src_list = src->CmdLists[n];
+        ImDrawList* dst_list = _AddListForSource(src->CmdLists[n]);
+        ImVectorCopyPreserveCapacity(dst_list->CmdBuffer, src_list->CmdBuffer);
+        ImVectorCopyPreserveCapacity(dst_list->IdxBuffer, src_list->IdxBuffer);
+        ImVectorCopyPreserveCapacity(dst_list->VtxBuffer, src_list->VtxBuffer);
+    }
+    _EndUpdate(src);
+}
+
+void ImDrawDataSnapshot::Clear()
+{
+    for (int n = 0; n < _Lists.Size; n++)
+        IM_DELETE(_Lists[n]);
+    _Lists.clear();
+    _ListsSource.clear();
+    _ListsLastUsed.clear();
+    _ListsMap.Clear();
+    _CmdLists.clear();
+    DrawData.Clear();
+}
+
+// Find or create the draw list we use for a given source draw list, and append it to DrawData.CmdLists[]
+ImDrawList* ImDrawDataSnapshot::_AddListForSource(ImDrawList* src_list)
+{
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_DrawList);
+    const ImGuiID key = ImHashData(&src_list, sizeof(src_list));
+    int list_idx = _ListsMap.GetInt(key, -1);
+    if (list_idx == -1 || _ListsSource[list_idx] != src_list)
+    {
+        list_idx = _Lists.Size;
+        _Lists.push_back(IM_NEW(ImDrawList)(src_list->_Data));
+        _ListsSource.push_back(src_list);
+        _ListsLastUsed.push_back(0);
+        _ListsMap.SetInt(key, list_idx);
+    }
+    _ListsLastUsed[list_idx] = _UpdateCount;
+
+    ImDrawList* dst_list = _Lists[list_idx];
+    dst_list->Flags = src_list->Flags;
+    dst_list->_OwnerName = src_list->_OwnerName;
+    _CmdLists.push_back(dst_list);
+    return dst_list;
+}
+
+void ImDrawDataSnapshot::_EndUpdate(const ImDrawData* src)
+{
+    DrawData.Valid = true;
+    DrawData.CmdLists = _CmdLists.Data;
+    DrawData.CmdListsCount = _CmdLists.Size;
+    DrawData.TotalIdxCount = src->TotalIdxCount;
+    DrawData.TotalVtxCount = src->TotalVtxCount;
+    DrawData.DisplayPos = src->DisplayPos;
+    DrawData.DisplaySize = src->DisplaySize;
+    DrawData.FramebufferScale = src->FramebufferScale;
+
+    // Garbage collect draw lists which haven't been used for a while
+    bool removed_any = false;
+    for (int n = 0; n < _Lists.Size; n++)
+        if (_UpdateCount - _ListsLastUsed[n] > DRAWDATA_SNAPSHOT_GC_UPDATES)
+        {
+            IM_DELETE(_Lists[n]);
+            _Lists[n] = _Lists.back();
+            _ListsSource[n] = _ListsSource.back();
+            _ListsLastUsed[n] = _ListsLastUsed.back();
+            _Lists.pop_back();
+            _ListsSource.pop_back();
+            _ListsLastUsed.pop_back();
+            removed_any = true;
+            n--;
+        }
+    if (removed_any)
+    {
+        _ListsMap.Data.resize(0);
+        for (int n = 0; n < _Lists.Size; n++)
+            _ListsMap.SetInt(ImHashData(&_ListsSource[n], sizeof(ImDrawList*)), n);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -1795,6 +1933,7 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
     // Build atlas on demand
     if (TexPixelsAlpha8 == NULL)
     {
+        ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_Fonts);
         if (ConfigData.empty())
             AddFontDefault();
         Build();
@@ -1812,6 +1951,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
     {
+        ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_Fonts);
         unsigned char* pixels = NULL;
         GetTexDataAsAlpha8(&pixels, NULL, NULL);
         if (pixels)
@@ -1835,6 +1975,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_Fonts);
 
     // Create new font
     if (!font_cfg->MergeMode)
@@ -2018,6 +2159,7 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 bool    ImFontAtlas::Build()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_Fonts);
     return ImFontAtlasBuildWithStbTruetype(this);
 }
 
@@ -2800,6 +2942,7 @@ void    ImFont::ClearOutputData()
 
 void ImFont::BuildLookupTable()
 {
+    ImGuiAllocCategoryScope alloc_category(ImGuiAllocCategory_Fonts);
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -49,6 +49,12 @@ Index of this file:
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
 
+// Enable SSE intrinsics if available
+#if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_ENABLE_SSE
+#include <immintrin.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -90,6 +96,7 @@ struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImGuiAllocStats;             // Allocation counters, per category (see ShowMetricsWindow())
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColumnData;             // Storage data for a single column
 struct ImGuiColumns;                // Storage data for a columns set
@@ -109,12 +116,15 @@ struct ImGuiSettingsHandler;        // Storage for one type registered in the .i
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
+struct ImGuiTextWrapCache;          // Line breaks of a long wrapped text, cached across frames by TextEx()
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
+struct ImGuiWindowHotData;          // Compact copy of the few fields of a visible window read by per-frame loops over all windows
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
+typedef int ImGuiAllocCategory;         // -> enum ImGuiAllocCategory_      // Enum: Attribution of allocations in ImGuiAllocStats
 typedef int ImGuiButtonFlags;           // -> enum ImGuiButtonFlags_        // Flags: for ButtonEx(), ButtonBehavior()
 typedef int ImGuiColumnsFlags;          // -> enum ImGuiColumnsFlags_       // Flags: BeginColumns()
 typedef int ImGuiItemFlags;             // -> enum ImGuiItemFlags_          // Flags: for PushItemFlag()
@@ -134,8 +144,19 @@ typedef int ImGuiTooltipFlags;          // -> enum ImGuiTooltipFlags_       // F
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#if (defined(__cplusplus) && __cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define IM_THREAD_LOCAL                 thread_local
+#elif defined(_MSC_VER)
+#define IM_THREAD_LOCAL                 __declspec(thread)
+#else
+#define IM_THREAD_LOCAL                 __thread
+#endif
+extern IMGUI_API IM_THREAD_LOCAL ImGuiContext* GImGui;  // Current implicit context pointer, one per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-------------------------------------------------------------------------
 // [SECTION] STB libraries includes
@@ -244,6 +265,7 @@ namespace ImStb
 // - Helper: ImBitVector
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImFrameArena, ImFrameArenaVector<>
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
@@ -282,6 +304,10 @@ IMGUI_API const char*   ImParseFormatFindStart(const char* format);
 IMGUI_API const char*   ImParseFormatFindEnd(const char* format);
 IMGUI_API const char*   ImParseFormatTrimDecorations(const char* format, char* buf, size_t buf_size);
 IMGUI_API int           ImParseFormatPrecision(const char* format, int default_value);
+IMGUI_API int           ImParseFormatIntegerBase(const char* format, bool* out_is_unsigned = NULL);
+IMGUI_API const char*   ImParseInteger(const char* str, int base, ImU64* out_magnitude, bool* out_negative);
+IMGUI_API const char*   ImParseDouble(const char* str, double* out);    // Locale independent, correctly rounded
+IMGUI_API const char*   ImParseFloat(const char* str, float* out);      // Locale independent, correctly rounded
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
 
@@ -528,6 +554,51 @@ struct IMGUI_API ImChunkStream
     T*      ptr_from_offset(int off)    { IM_ASSERT(off >= 4 && off < Buf.Size); return (T*)(void*)(Buf.Data + off); }
 };
 
+// Helper: ImFrameArena
+// Linear allocator for transient data, everything allocated from it is released at once by Reset() (once per frame in NewFrame()).
+// When the main block is exhausted we fall back to individual heap allocations, and the next Reset() grows the main block
+// to cover the peak usage, so a steady state doesn't touch the heap.
+struct IMGUI_API ImFrameArena
+{
+    char*           Data;               // Main block
+    int             Size;               // Bytes used in main block
+    int             Capacity;           // Size of main block
+    int             OverflowSize;       // Bytes allocated outside of the main block since last Reset()
+    ImVector<void*> OverflowBlocks;     // Heap allocations made since last Reset() because the main block was full
+    int             PeakSizeLastFrame;  // [Metrics] Bytes used (main + overflow) between the two last calls to Reset()
+    int             PeakSizeEver;       // [Metrics] Max of PeakSizeLastFrame
+    int             OverflowCount;      // [Metrics] Number of Reset() that had to grow the main block
+
+    ImFrameArena()                      { Data = NULL; Size = Capacity = OverflowSize = PeakSizeLastFrame = PeakSizeEver = OverflowCount = 0; }
+    ~ImFrameArena()                     { Clear(); }
+    void*           Alloc(size_t sz)    { sz = (sz + 15) & ~(size_t)15; if (Size + sz <= (size_t)Capacity) { void* p = Data + Size; Size += (int)sz; return p; } return AllocOverflow(sz); }
+    IMGUI_API void* AllocOverflow(size_t sz);
+    IMGUI_API void  Reset();
+    IMGUI_API void  Clear();
+};
+
+// Helper: ImFrameArenaVector<>
+// Growable array allocated from a ImFrameArena. Only use with POD types. Growing leaves the previous storage in the arena until its next Reset().
+// Contents become invalid when the arena is reset: call Reset() on the vector before using it again.
+template<typename T>
+struct ImFrameArenaVector
+{
+    int             Size;
+    int             Capacity;
+    T*              Data;
+    ImFrameArena*   Arena;
+
+    ImFrameArenaVector()                { Size = Capacity = 0; Data = NULL; Arena = NULL; }
+    void            Reset(ImFrameArena* arena)  { Size = Capacity = 0; Data = NULL; Arena = arena; }
+    bool            empty() const       { return Size == 0; }
+    T&              operator[](int i)   { IM_ASSERT(i >= 0 && i < Size); return Data[i]; }
+    T&              back()              { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+    void            reserve(int new_capacity)   { if (new_capacity <= Capacity) return; IM_ASSERT(Arena != NULL); T* new_data = (T*)Arena->Alloc((size_t)new_capacity * sizeof(T)); if (Data) memcpy(new_data, Data, (size_t)Size * sizeof(T)); Data = new_data; Capacity = new_capacity; }
+    void            resize(int new_size)        { if (new_size > Capacity) reserve(ImMax(new_size, Capacity ? Capacity * 2 : 8)); Size = new_size; }
+    void            push_back(const T& v)       { if (Size == Capacity) reserve(Capacity ? Capacity * 2 : 8); memcpy(&Data[Size], &v, sizeof(v)); Size++; }
+    void            pop_back()                  { IM_ASSERT(Size > 0); Size--; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -984,6 +1055,36 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Line breaks of a long wrapped text, cached across frames by TextEx() in g.TextWrapCaches, keyed by window and text pointer.
+// While the text contents, font and wrap width don't change, the text isn't measured again and only its visible lines are rendered.
+// The text contents are compared with a copy, as memcmp() is much faster than hashing them with ImHashData().
+struct ImGuiTextWrapCache
+{
+    struct Line { int Begin, End; };        // Offsets in the text. Blanks skipped after a wrap and '\n' are excluded.
+
+    ImVector<char>      Text;               // Copy of the text the line breaks were computed for
+    ImFont*             Font;
+    float               FontSize;
+    float               WrapWidth;
+    float               LastTimeUsed;
+    int                 LastFrameUsed;
+    ImVec2              Size;               // Same as CalcTextSize(text, text_end, false, WrapWidth)
+    ImVector<Line>      Lines;
+
+    ImGuiTextWrapCache() { Font = NULL; FontSize = WrapWidth = LastTimeUsed = 0.0f; LastFrameUsed = -1; }
+};
+
+// Hot/cold split: ImGuiWindow is large and per-frame loops over all windows only read a few of its fields.
+// Those are copied in a contiguous array (g.WindowsHotData) so such loops don't have to touch every window.
+struct ImGuiWindowHotData
+{
+    ImGuiWindow*            Window;
+    ImGuiWindow*            RootWindow;
+    ImRect                  OuterRectClipped;
+    ImGuiWindowFlags        Flags;
+    bool                    HasHitTestHole;         // == (Window->HitTestHoleSize.x != 0)
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Columns support
 //-----------------------------------------------------------------------------
@@ -1111,9 +1212,13 @@ struct ImGuiMetricsConfig
     bool        ShowDrawCmdBoundingBoxes;
     int         ShowWindowsRectsType;
     int         ShowTablesRectsType;
+    float       MemoryHistory[120];     // Total bytes reserved (in KB) recorded on each frame the Metrics window is visible
+    int         MemoryHistoryIdx;
 
     ImGuiMetricsConfig()
     {
+        memset(MemoryHistory, 0, sizeof(MemoryHistory));
+        MemoryHistoryIdx = 0;
         ShowWindowsRects = false;
         ShowWindowsBeginOrder = false;
         ShowTablesRects = false;
@@ -1124,6 +1229,28 @@ struct ImGuiMetricsConfig
     }
 };
 
+// Allocations made through MemAlloc() are attributed to the category active at the time of the call (see ImGuiAllocCategoryScope)
+enum ImGuiAllocCategory_
+{
+    ImGuiAllocCategory_Misc,            // ImVector growth and everything not attributed below
+    ImGuiAllocCategory_DrawList,        // ImDrawList/ImDrawListSplitter buffers
+    ImGuiAllocCategory_TextBuffer,      // ImGuiTextBuffer contents (logging, .ini saving, etc.)
+    ImGuiAllocCategory_Fonts,           // ImFontAtlas/ImFont building
+    ImGuiAllocCategory_Windows,         // ImGuiWindow creation and per-window buffers
+    ImGuiAllocCategory_COUNT
+};
+
+struct ImGuiAllocStats
+{
+    int         Count[ImGuiAllocCategory_COUNT];    // Number of calls to MemAlloc()
+    size_t      Bytes[ImGuiAllocCategory_COUNT];    // Sum of requested sizes
+
+    ImGuiAllocStats()       { Clear(); }
+    void        Clear()     { memset(this, 0, sizeof(*this)); }
+    int         GetTotalCount() const   { int n = 0; for (int i = 0; i < ImGuiAllocCategory_COUNT; i++) n += Count[i]; return n; }
+    size_t      GetTotalBytes() const   { size_t n = 0; for (int i = 0; i < ImGuiAllocCategory_COUNT; i++) n += Bytes[i]; return n; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -1149,6 +1276,7 @@ struct ImGuiContext
 {
     bool                    Initialized;
     bool                    FontAtlasOwnedByContext;            // IO.Fonts-> is owned by the ImGuiContext and will be destructed along with it.
+    bool                    FontAtlasLockedByContext;           // IO.Fonts->Locked was set by NewFrame() and will be cleared by EndFrame(). Atlases locked by the user are left untouched.
     ImGuiIO                 IO;
     ImGuiStyle              Style;
     ImFont*                 Font;                               // (Shortcut) == FontStack.empty() ? IO.Font : FontStack.back()
@@ -1169,9 +1297,15 @@ struct ImGuiContext
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Windows, sorted in focus order, back to front. (FIXME: We could only store root windows here! Need to sort out the Docking equivalent which is RootWindowDockStop and is unfortunately a little more dynamic)
-    ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImFrameArena            FrameArena;                         // Linear allocator for transient data, reset in NewFrame()
     ImVector<ImGuiWindow*>  CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
+    ImGuiStorage            ChildWindowsByParentId;             // Map (parent window ID, child ID) to child ImGuiWindow*. Allow BeginChild() to find an existing child without formatting/hashing its full title.
+    ImVector<ImGuiWindowHotData> WindowsHotData;                // Visible windows which accept mouse inputs, back to front, rebuilt by EndFrame() (see FindHoveredWindow())
+    bool                    WindowsHotDataDirty;                // Set when g.Windows is reordered after WindowsHotData was built
+    int                     WindowsOccludedCount;               // Number of windows culled by io.ConfigWindowsOcclusionCulling during the current frame
+    ImVector<void*>         WindowsPoolBlocks;                  // ImGuiWindow instances are allocated in blocks
+    int                     WindowsPoolBlockUsed;               // Number of instances used in the last block
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
@@ -1223,6 +1357,10 @@ struct ImGuiContext
     ImVector<ImGuiPopupData>OpenPopupStack;                     // Which popups are open (persistent)
     ImVector<ImGuiPopupData>BeginPopupStack;                    // Which level of BeginPopup() we are in (reset every frame)
 
+    // Style colors cache
+    ImU32                   StyleColorsU32[ImGuiCol_COUNT];     // Packed colors returned by GetColorU32(ImGuiCol). Each entry is only valid while it matches StyleColorsU32Src[].
+    ImVec4                  StyleColorsU32Src[ImGuiCol_COUNT];  // Style.Colors[] value with its alpha multiplied by Style.Alpha, as used to compute StyleColorsU32[]
+
     // Gamepad/keyboard Navigation
     ImGuiWindow*            NavWindow;                          // Focused window for navigation. Could be called 'FocusWindow'
     ImGuiID                 NavId;                              // Focused item for navigation
@@ -1331,6 +1469,7 @@ struct ImGuiContext
     int                     TooltipOverrideCount;
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
+    ImPool<ImGuiTextWrapCache>  TextWrapCaches;                 // Line breaks of long wrapped texts (see TextEx()). Released after io.ConfigWindowsMemoryCompactTimer seconds unused.
 
     // Platform support
     ImVec2                  PlatformImePos;                     // Cursor position request & last passed to the OS Input Method Editor
@@ -1360,6 +1499,11 @@ struct ImGuiContext
     bool                    DebugItemPickerActive;              // Item picker is active (started with DebugStartItemPicker())
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this id
     ImGuiMetricsConfig      DebugMetricsConfig;
+    ImGuiAllocCategory      DebugAllocCategory;                 // Category that MemAlloc() calls are attributed to (see ImGuiAllocCategoryScope)
+    ImGuiAllocStats         DebugAllocStatsThisFrame;           // Allocations made since the beginning of the current frame
+    ImGuiAllocStats         DebugAllocStatsLastFrame;           // Allocations made during the previous frame
+    ImGuiAllocStats         DebugAllocStatsTotal;               // Allocations made since the context was created
+    bool                    DebugAllocAssertEnabled;            // Set by NewFrame() when io.ConfigDebugNoAllocAfterFrames is reached
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
@@ -1368,12 +1512,18 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture via CaptureKeyboardFromApp()/CaptureMouseFromApp() sets those flags
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
+    size_t                  GcMemoryUsage;                      // Bytes held by transient buffers that garbage collection can release (see io.ConfigMemoryCompactBudget), updated by NewFrame() when the budget is enabled
+    int                     GcMemoryCompactCount;               // Number of buffers compacted because io.ConfigMemoryCompactBudget was exceeded
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
 
     ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
     {
         Initialized = false;
         FontAtlasOwnedByContext = shared_font_atlas ? false : true;
+        FontAtlasLockedByContext = false;
+        WindowsHotDataDirty = true;
+        WindowsOccludedCount = 0;
+        WindowsPoolBlockUsed = 0;
         Font = NULL;
         FontSize = FontBaseSize = 0.0f;
         IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
@@ -1455,6 +1605,12 @@ struct ImGuiContext
         FocusRequestNextCounterRegular = FocusRequestNextCounterTabStop = INT_MAX;
         FocusTabPressed = false;
 
+        for (int n = 0; n < ImGuiCol_COUNT; n++)
+        {
+            StyleColorsU32[n] = 0;                                  // == ColorConvertFloat4ToU32(StyleColorsU32Src[n])
+            StyleColorsU32Src[n] = ImVec4(-1.0f, -1.0f, -1.0f, -1.0f);
+        }
+
         DimBgRatio = 0.0f;
         BackgroundDrawList._OwnerName = "##Background"; // Give it a name for debugging
         ForegroundDrawList._OwnerName = "##Foreground"; // Give it a name for debugging
@@ -1503,15 +1659,30 @@ struct ImGuiContext
 
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+        DebugAllocCategory = ImGuiAllocCategory_Misc;
+        DebugAllocAssertEnabled = false;
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+        GcMemoryUsage = 0;
+        GcMemoryCompactCount = 0;
         memset(TempBuffer, 0, sizeof(TempBuffer));
     }
 };
 
+// Helper: attribute MemAlloc() calls made within the scope to a given category (see ImGuiAllocStats, ShowMetricsWindow())
+// Only place those around code paths that may allocate, they are not free.
+struct ImGuiAllocCategoryScope
+{
+    ImGuiContext*       Ctx;
+    ImGuiAllocCategory  BackupCategory;
+
+    ImGuiAllocCategoryScope(ImGuiAllocCategory category)  { Ctx = GImGui; if (Ctx) { BackupCategory = Ctx->DebugAllocCategory; Ctx->DebugAllocCategory = category; } else { BackupCategory = ImGuiAllocCategory_Misc; } }
+    ~ImGuiAllocCategoryScope()                            { if (Ctx) Ctx->DebugAllocCategory = BackupCategory; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiWindowTempData, ImGuiWindow
 //-----------------------------------------------------------------------------
@@ -1566,10 +1737,10 @@ struct IMGUI_API ImGuiWindowTempData
     ImGuiItemFlags          ItemFlags;              // == ItemFlagsStack.back() [empty == ImGuiItemFlags_Default]
     float                   ItemWidth;              // == ItemWidthStack.back(). 0.0: default, >0.0: width in pixels, <0.0: align xx pixels to the right of window
     float                   TextWrapPos;            // == TextWrapPosStack.back() [empty == -1.0f]
-    ImVector<ImGuiItemFlags>ItemFlagsStack;
-    ImVector<float>         ItemWidthStack;
-    ImVector<float>         TextWrapPosStack;
-    ImVector<ImGuiGroupData>GroupStack;
+    ImFrameArenaVector<ImGuiItemFlags>  ItemFlagsStack;     // Stacks are allocated from g.FrameArena, reset on the first Begin() of the frame
+    ImFrameArenaVector<float>           ItemWidthStack;
+    ImFrameArenaVector<float>           TextWrapPosStack;
+    ImFrameArenaVector<ImGuiGroupData>  GroupStack;
     short                   StackSizesBackup[6];    // Store size of various stacks for asserting
 
     ImGuiWindowTempData()
@@ -1640,6 +1811,7 @@ struct IMGUI_API ImGuiWindow
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
+    bool                    IsOpaque;                           // Set when the window background and title bar were rendered fully opaque during the last Begin() (can occlude other windows)
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
     signed char             ResizeBorderHeld;                   // Current border being held for resize (-1: none, otherwise 0-3)
     short                   BeginCount;                         // Number of Begin() during the current frame (generally 0 or 1, 1+ if appending via multiple Begin/End pairs)
@@ -1683,10 +1855,12 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImVector<ImDrawList*>   DrawListsAppended;                  // Draw lists recorded outside of this window (e.g. on worker threads) and rendered right after DrawList, before child windows. Cleared by Begin().
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window == Top-level window.
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
     ImGuiWindow*            RootWindowForNav;                   // Point to ourself or first ancestor which doesn't have the NavFlattened flag.
+    ImGuiWindow*            OccludedBy;                         // Set by EndFrame() when io.ConfigWindowsOcclusionCulling is enabled and an opaque window displayed above us fully covered us.
 
     ImGuiWindow*            NavLastChildNavWindow;              // When going to the menu bar, we remember the child window we came from. (This could probably be made implicit if we kept g.Windows sorted by last focused including child window.)
     ImGuiID                 NavLastIds[ImGuiNavLayer_COUNT];    // Last known NavId for this window, per layer (0/1)
@@ -2089,11 +2263,15 @@ namespace ImGui
     // Garbage collection
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API size_t        GcCalcTransientWindowBuffersSize(ImGuiWindow* window);
+    IMGUI_API void          GcCompactToMemoryBudget(size_t budget);
 
     // Debug Tools
     inline void             DebugDrawItemRect(ImU32 col = IM_COL32(255,0,0,255))    { ImGuiContext& g = *GImGui; ImGuiWindow* window = g.CurrentWindow; GetForegroundDrawList(window)->AddRect(window->DC.LastItemRect.Min, window->DC.LastItemRect.Max, col); }
     inline void             DebugStartItemPicker()                                  { ImGuiContext& g = *GImGui; g.DebugItemPickerActive = true; }
 
+    IMGUI_API void          DebugGetAllocStats(ImGuiAllocStats* out_last_frame, ImGuiAllocStats* out_total);  // Allocations made during the last frame / since context creation
+
     IMGUI_API void          DebugNodeColumns(ImGuiColumns* columns);
     IMGUI_API void          DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list, const char* label);
     IMGUI_API void          DebugNodeDrawCmdShowMeshAndBoundingBox(ImGuiWindow* window, const ImDrawList* draw_list, const ImDrawCmd* draw_cmd, bool show_mesh, bool show_aabb);
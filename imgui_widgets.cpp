@@ -41,6 +41,7 @@ Index of this file:
 #include "imgui_internal.h"
 
 #include <ctype.h>      // toupper
+#include <locale.h>     // localeconv
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
@@ -120,6 +121,7 @@ static ImVec2           InputTextCalcTextSizeW(const ImWchar* text_begin, const
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Text, etc.
 //-------------------------------------------------------------------------
+// - GetTextWrapCache() [Internal]
 // - TextEx() [Internal]
 // - TextUnformatted()
 // - Text()
@@ -136,6 +138,101 @@ static ImVec2           InputTextCalcTextSizeW(const ImWchar* text_begin, const
 // - BulletTextV()
 //-------------------------------------------------------------------------
 
+// Same as ImFont::CalcTextSizeA() with max_width = FLT_MAX, also recording where each line begins and ends
+static void TextWrapCacheBuild(ImGuiTextWrapCache* cache, ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    const float scale = size / font->FontSize;
+    float max_line_width = 0.0f;
+    float line_width = 0.0f;
+    const char* word_wrap_eol = NULL;
+    const char* line_begin = text_begin;
+
+    cache->Lines.resize(0);
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (!word_wrap_eol)
+        {
+            word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+            if (word_wrap_eol == s)
+                word_wrap_eol++;
+        }
+        if (s >= word_wrap_eol)
+        {
+            ImGuiTextWrapCache::Line line = { (int)(line_begin - text_begin), (int)(s - text_begin) };
+            cache->Lines.push_back(line);
+            max_line_width = ImMax(max_line_width, line_width);
+            line_width = 0.0f;
+            word_wrap_eol = NULL;
+
+            // Wrapping skips upcoming blanks
+            while (s < text_end)
+            {
+                const char c = *s;
+                if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+            }
+            line_begin = s;
+            continue;
+        }
+
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+        {
+            s += 1;
+        }
+        else
+        {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0) // Malformed UTF-8?
+                break;
+        }
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                ImGuiTextWrapCache::Line line = { (int)(line_begin - text_begin), (int)(s - 1 - text_begin) };
+                cache->Lines.push_back(line);
+                max_line_width = ImMax(max_line_width, line_width);
+                line_width = 0.0f;
+                line_begin = s;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+        line_width += ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
+    }
+    if (line_width > 0.0f || cache->Lines.Size == 0)
+    {
+        ImGuiTextWrapCache::Line line = { (int)(line_begin - text_begin), (int)(s - text_begin) };
+        cache->Lines.push_back(line);
+        max_line_width = ImMax(max_line_width, line_width);
+    }
+    cache->Size = ImVec2(IM_FLOOR(max_line_width + 0.95f), cache->Lines.Size * size);
+}
+
+// Line breaks of a text wrapped with the current font, measured again only when the text contents, font or wrap width changed.
+static ImGuiTextWrapCache* GetTextWrapCache(const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiTextWrapCache* cache = g.TextWrapCaches.GetOrAddByKey(window->GetIDNoKeepAlive((const void*)text));
+    const int text_len = (int)(text_end - text);
+    if (cache->Text.Size != text_len || memcmp(cache->Text.Data, text, (size_t)text_len) != 0 || cache->Font != g.Font || cache->FontSize != g.FontSize || cache->WrapWidth != wrap_width)
+    {
+        cache->Text.resize(text_len);
+        memcpy(cache->Text.Data, text, (size_t)text_len);
+        cache->Font = g.Font;
+        cache->FontSize = g.FontSize;
+        cache->WrapWidth = wrap_width;
+        TextWrapCacheBuild(cache, g.Font, g.FontSize, wrap_width, text, text_end);
+    }
+    cache->LastTimeUsed = (float)g.Time;
+    cache->LastFrameUsed = g.FrameCount;
+    return cache;
+}
+
 void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -155,7 +252,7 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
     {
         // Long text!
         // Perform manual coarse clipping to optimize for long multi-line text
-        // - From this point we will only compute the width of lines that are visible. Optimization only available when word-wrapping is disabled.
+        // - From this point we will only compute the width of lines that are visible. Word-wrapped text is handled below.
         // - We also don't vertically center the text within the line full height, which is unlikely to matter because we are likely the biggest and only item on the line.
         // - We use memchr(), pay attention that well optimized versions of those str/mem functions are much faster than a casually written loop.
         const char* line = text;
@@ -224,6 +321,29 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
         ItemSize(text_size, 0.0f);
         ItemAdd(bb, 0);
     }
+    else if (text_end - text > 2000 && !g.LogEnabled)
+    {
+        // Long wrapped text!
+        // - Line breaks are cached across frames, so the text is only measured again when its contents, the font or the wrap width change.
+        // - From the cached line breaks we can render only the visible lines.
+        const float wrap_width = CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x);
+        const ImGuiTextWrapCache* cache = GetTextWrapCache(text_begin, text_end, wrap_width);
+        const ImVec2 text_size = cache->Size;
+
+        ImRect bb(text_pos, text_pos + text_size);
+        ItemSize(text_size, 0.0f);
+        if (!ItemAdd(bb, 0))
+            return;
+
+        const float line_height = g.FontSize;
+        const int line_n_begin = ImMax((int)((window->ClipRect.Min.y - text_pos.y) / line_height), 0);
+        const int line_n_end = ImMin((int)((window->ClipRect.Max.y - text_pos.y) / line_height) + 1, cache->Lines.Size);
+        for (int line_n = line_n_begin; line_n < line_n_end; line_n++)
+        {
+            const ImGuiTextWrapCache::Line& line = cache->Lines[line_n];
+            RenderText(ImVec2(text_pos.x, text_pos.y + line_n * line_height), text_begin + line.Begin, text_begin + line.End, false);
+        }
+    }
     else
     {
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
@@ -1486,6 +1606,7 @@ void ImGui::ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_exc
 // - BeginCombo()
 // - EndCombo()
 // - Combo()
+// - ImGuiComboFilter
 //-------------------------------------------------------------------------
 
 static float CalcMaxPopupHeightFromItemCount(int items_count)
@@ -1641,6 +1762,30 @@ static bool Items_SingleStringGetter(void* data, int idx, const char** out_text)
 
 // Old API, prefer using BeginCombo() nowadays if you can.
 bool ImGui::Combo(const char* label, int* current_item, bool (*items_getter)(void*, int, const char**), void* data, int items_count, int popup_max_height_in_items)
+{
+    return Combo(label, current_item, items_getter, data, items_count, (ImGuiComboFilter*)NULL, popup_max_height_in_items);
+}
+
+static bool ComboItem(bool (*items_getter)(void*, int, const char**), void* data, int item_idx, int* current_item)
+{
+    ImGui::PushID((void*)(intptr_t)item_idx);
+    const bool item_selected = (item_idx == *current_item);
+    const char* item_text;
+    if (!items_getter(data, item_idx, &item_text))
+        item_text = "*Unknown item*";
+    bool value_changed = false;
+    if (ImGui::Selectable(item_text, item_selected))
+    {
+        value_changed = true;
+        *current_item = item_idx;
+    }
+    ImGui::PopID();
+    return value_changed;
+}
+
+// Large lists are clipped, so opening and scrolling a combo of 1M items only costs the visible items.
+// With a filter, the items starting with the typed text are listed in alphabetical order.
+bool ImGui::Combo(const char* label, int* current_item, bool (*items_getter)(void*, int, const char**), void* data, int items_count, ImGuiComboFilter* filter, int popup_max_height_in_items)
 {
     ImGuiContext& g = *GImGui;
 
@@ -1649,37 +1794,165 @@ bool ImGui::Combo(const char* label, int* current_item, bool (*items_getter)(voi
     if (*current_item >= 0 && *current_item < items_count)
         items_getter(data, *current_item, &preview_value);
 
+    // The filter is only used once its prefix index was built for those items, as building it is O(N log N)
+    IM_ASSERT((filter == NULL || filter->SortedItems.Size == items_count) && "Call ImGuiComboFilter::Build() before Combo(), and again when the items change.");
+    if (filter != NULL && filter->SortedItems.Size != items_count)
+        filter = NULL;
+
+    // The popup auto-fits the width of the submitted items. Clipping would make it change while scrolling, so we only clip large lists
+    // (whose items are too many to measure every frame) and give their popup the width of the combo. Longer items are clipped.
+    const int clip_items_count_min = 1000;
+    const bool clip_items = (items_count >= clip_items_count_min);
+
     // The old Combo() API exposed "popup_max_height_in_items". The new more general BeginCombo() API doesn't have/need it, but we emulate it here.
-    if (popup_max_height_in_items != -1 && !(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasSizeConstraint))
-        SetNextWindowSizeConstraints(ImVec2(0, 0), ImVec2(FLT_MAX, CalcMaxPopupHeightFromItemCount(popup_max_height_in_items)));
+    // The filter input is added on top of the items.
+    if ((popup_max_height_in_items != -1 || filter != NULL || clip_items) && !(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasSizeConstraint))
+    {
+        const float max_height = CalcMaxPopupHeightFromItemCount(popup_max_height_in_items != -1 ? popup_max_height_in_items : 8);
+        const float width = clip_items ? CalcItemWidth() : FLT_MAX;
+        SetNextWindowSizeConstraints(ImVec2(0, 0), ImVec2(width, filter ? max_height + GetFrameHeightWithSpacing() : max_height));
+    }
 
     if (!BeginCombo(label, preview_value, ImGuiComboFlags_None))
         return false;
 
-    // Display items
-    // FIXME-OPT: Use clipper (but we need to disable it on the appearing frame to make sure our call to SetItemDefaultFocus() is processed)
+    ImGuiWindow* window = g.CurrentWindow;
+    const bool current_item_valid = (*current_item >= 0 && *current_item < items_count);
     bool value_changed = false;
-    for (int i = 0; i < items_count; i++)
+
+    // Filter: list the range of the prefix index matching the input, in place of all items
+    const int* list_items = NULL;   // NULL: list all items in their order
+    int list_count = items_count;
+    if (filter)
     {
-        PushID((void*)(intptr_t)i);
-        const bool item_selected = (i == *current_item);
-        const char* item_text;
-        if (!items_getter(data, i, &item_text))
-            item_text = "*Unknown item*";
-        if (Selectable(item_text, item_selected))
+        if (window->Appearing)
+        {
+            filter->InputBuf[0] = 0;
+            SetKeyboardFocusHere();
+        }
+        SetNextItemWidth(-FLT_MIN);
+        if (InputTextWithHint("##Filter", "Filter", filter->InputBuf, IM_ARRAYSIZE(filter->InputBuf)))
+            SetScrollY(0.0f);
+        filter->Search(items_getter, data);
+        if (filter->IsActive())
+        {
+            list_items = filter->SortedItems.Data + filter->MatchBegin;
+            list_count = filter->MatchEnd - filter->MatchBegin;
+        }
+
+        // Enter: select the first match
+        if (IsItemDeactivated() && IsKeyPressedMap(ImGuiKey_Enter) && list_items != NULL && list_count > 0)
         {
+            *current_item = list_items[0];
             value_changed = true;
-            *current_item = i;
+            CloseCurrentPopup();
         }
-        if (item_selected)
-            SetItemDefaultFocus();
-        PopID();
+    }
+
+    // Display items
+    const float start_pos_y = window->DC.CursorPos.y;
+    const float item_height = GetTextLineHeightWithSpacing();
+    bool current_item_submitted = false;
+    ImGuiListClipper clipper;
+    if (clip_items)
+        clipper.Begin(list_count, item_height);
+    for (int step = 0; clip_items ? clipper.Step() : (step == 0); step++) // Without clipping: a single step over all the items
+        for (int n = clip_items ? clipper.DisplayStart : 0, n_end = clip_items ? clipper.DisplayEnd : list_count; n < n_end; n++)
+        {
+            const int item_idx = list_items ? list_items[n] : n;
+            value_changed |= ComboItem(items_getter, data, item_idx, current_item);
+            if (item_idx == *current_item && filter == NULL)
+            {
+                SetItemDefaultFocus();
+                current_item_submitted = true;
+            }
+        }
+
+    // On the appearing frame, also submit the current item at its position if it was clipped, so SetItemDefaultFocus() can focus it and scroll to it.
+    // With a filter the popup opens at the top instead, as scrolling would clip the filter input and lose its keyboard focus.
+    if (window->Appearing && filter == NULL && current_item_valid && !current_item_submitted)
+    {
+        SetCursorScreenPos(ImVec2(window->DC.CursorPos.x, start_pos_y + *current_item * item_height));
+        value_changed |= ComboItem(items_getter, data, *current_item, current_item);
+        SetItemDefaultFocus();
     }
 
     EndCombo();
     return value_changed;
 }
 
+// Prefix index: sort the items by text once, then the items starting with a prefix are a contiguous range found by binary search.
+// Texts compare with toupper() on each character, as ImStricmp()/ImStrnicmp(), so the order of the sort and of the search agree.
+struct ImGuiComboFilterSortItem
+{
+    const char* Text;
+    int         Idx;
+};
+
+static int IMGUI_CDECL ComboFilterCompareItems(const void* lhs, const void* rhs)
+{
+    const ImGuiComboFilterSortItem* a = (const ImGuiComboFilterSortItem*)lhs;
+    const ImGuiComboFilterSortItem* b = (const ImGuiComboFilterSortItem*)rhs;
+    if (int d = ImStricmp(b->Text, a->Text))
+        return d;
+    return a->Idx - b->Idx;
+}
+
+void ImGuiComboFilter::Build(const char* const items[], int items_count)
+{
+    Build(Items_ArrayGetter, (void*)items, items_count);
+}
+
+void ImGuiComboFilter::Build(bool (*items_getter)(void*, int, const char**), void* data, int items_count)
+{
+    ImVector<ImGuiComboFilterSortItem> sort_items;
+    sort_items.resize(items_count);
+    for (int n = 0; n < items_count; n++)
+    {
+        sort_items[n].Idx = n;
+        if (!items_getter(data, n, &sort_items[n].Text))
+            sort_items[n].Text = "";
+    }
+    if (items_count > 1)
+        ImQsort(sort_items.Data, (size_t)items_count, sizeof(ImGuiComboFilterSortItem), ComboFilterCompareItems);
+    SortedItems.resize(items_count);
+    for (int n = 0; n < items_count; n++)
+        SortedItems[n] = sort_items[n].Idx;
+    MatchBegin = MatchEnd = 0;
+}
+
+// Binary search of the first sorted item not before 'prefix' (upper_bound == false) or after 'prefix' (upper_bound == true), comparing the first prefix_len characters
+static int ComboFilterFindBound(const ImGuiComboFilter* filter, bool (*items_getter)(void*, int, const char**), void* data, const char* prefix, size_t prefix_len, bool upper_bound)
+{
+    int lo = 0, hi = filter->SortedItems.Size;
+    while (lo < hi)
+    {
+        const int mid = lo + (hi - lo) / 2;
+        const char* text;
+        if (!items_getter(data, filter->SortedItems[mid], &text))
+            text = "";
+        const int d = ImStrnicmp(prefix, text, prefix_len); // > 0 when text is after prefix
+        if (upper_bound ? (d <= 0) : (d < 0))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+void ImGuiComboFilter::Search(bool (*items_getter)(void*, int, const char**), void* data)
+{
+    const size_t prefix_len = strlen(InputBuf);
+    if (prefix_len == 0)
+    {
+        MatchBegin = 0;
+        MatchEnd = SortedItems.Size;
+        return;
+    }
+    MatchBegin = ComboFilterFindBound(this, items_getter, data, InputBuf, prefix_len, false);
+    MatchEnd = ComboFilterFindBound(this, items_getter, data, InputBuf, prefix_len, true);
+}
+
 // Combo box helper allowing to pass an array of strings.
 bool ImGui::Combo(const char* label, int* current_item, const char* const items[], int items_count, int height_in_items)
 {
@@ -1687,6 +1960,12 @@ bool ImGui::Combo(const char* label, int* current_item, const char* const items[
     return value_changed;
 }
 
+bool ImGui::Combo(const char* label, int* current_item, const char* const items[], int items_count, ImGuiComboFilter* filter, int height_in_items)
+{
+    const bool value_changed = Combo(label, current_item, Items_ArrayGetter, (void*)items, items_count, filter, height_in_items);
+    return value_changed;
+}
+
 // Combo box helper allowing to pass all items in a single string literal holding multiple zero-terminated items "item1\0item2\0"
 bool ImGui::Combo(const char* label, int* current_item, const char* items_separated_by_zeros, int height_in_items)
 {
@@ -1837,6 +2116,27 @@ void ImGui::DataTypeApplyOp(ImGuiDataType data_type, int op, void* output, const
     IM_ASSERT(0);
 }
 
+// Parse an integer into the destination type. Return false (and leave *output untouched) if no number could be read.
+// 'wrap_size' is the width in bytes the value wraps around to before being stored: sizeof(TYPE) (e.g. "FFFFFFFF" gives -1 for an int),
+// 4 for a smaller type (wrapped to an int then clamped to [v_min, v_max], same as a sscanf() into an int), or 0 to clamp to [v_min, v_max].
+template<typename TYPE>
+static bool DataTypeParseIntegerT(const char* buf, int base, int wrap_size, TYPE* output, const TYPE v_min, const TYPE v_max)
+{
+    ImU64 magnitude;
+    bool negative;
+    if (!ImParseInteger(buf, base, &magnitude, &negative))
+        return false;
+    if (wrap_size == (int)sizeof(TYPE))
+        *output = (TYPE)(negative ? (ImU64)0 - magnitude : magnitude);
+    else if (wrap_size == 4)
+        *output = (TYPE)ImClamp((ImS64)(ImS32)(ImU32)(negative ? (ImU64)0 - magnitude : magnitude), (ImS64)v_min, (ImS64)v_max);
+    else if (negative && magnitude != 0)
+        *output = (v_min == 0 || magnitude - 1 >= (ImU64)(-((ImS64)v_min + 1))) ? v_min : (TYPE)(-(ImS64)magnitude);
+    else
+        *output = (magnitude >= (ImU64)v_max) ? v_max : (TYPE)magnitude;
+    return true;
+}
+
 // User can input math operators (e.g. +100) to edit a numerical values.
 // NB: This is _not_ a full expression evaluator. We should probably add one and replace this dumb mess..
 bool ImGui::DataTypeApplyOpFromText(const char* buf, const char* initial_value_buf, ImGuiDataType data_type, void* p_data, const char* format)
@@ -1869,29 +2169,33 @@ bool ImGui::DataTypeApplyOpFromText(const char* buf, const char* initial_value_b
         format = type_info->ScanFmt;
 
     // FIXME-LEGACY: The aim is to remove those operators and write a proper expression evaluator at some point..
-    int arg1i = 0;
+    // Integers are read in the base of the format (e.g. hexadecimal for "%X"). Same as scanf(), values read with an unsigned conversion ("%u", "%x", "%X", "%o")
+    // wrap around to the width of the destination type, so "FFFFFFFF" read with "%08X" gives -1 for a S32. Out of range signed decimal values are clamped.
+    // 8/16-bit types read with "%u" (the default format of U8 and U16) wrap around to an int then are clamped, so "300" gives 255 and "-1" gives 0 for a U8.
+    bool is_unsigned = false;
+    const int base = ImParseFormatIntegerBase(format, &is_unsigned);
+    const int wrap_size = !is_unsigned ? 0 : (base == 10 && type_info->Size < 4) ? 4 : (int)type_info->Size;
     if (data_type == ImGuiDataType_S32)
     {
         int* v = (int*)p_data;
-        int arg0i = *v;
+        int arg0i = *v, arg1i = 0;
         float arg1f = 0.0f;
-        if (op && sscanf(initial_value_buf, format, &arg0i) < 1)
+        if (op && !DataTypeParseIntegerT<int>(initial_value_buf, base, wrap_size, &arg0i, IM_S32_MIN, IM_S32_MAX))
             return false;
         // Store operand in a float so we can use fractional value for multipliers (*1.1), but constant always parsed as integer so we can fit big integers (e.g. 2000000003) past float precision
-        if (op == '+')      { if (sscanf(buf, "%d", &arg1i)) *v = (int)(arg0i + arg1i); }                   // Add (use "+-" to subtract)
-        else if (op == '*') { if (sscanf(buf, "%f", &arg1f)) *v = (int)(arg0i * arg1f); }                   // Multiply
-        else if (op == '/') { if (sscanf(buf, "%f", &arg1f) && arg1f != 0.0f) *v = (int)(arg0i / arg1f); }  // Divide
-        else                { if (sscanf(buf, format, &arg1i) == 1) *v = arg1i; }                           // Assign constant
+        if (op == '+')      { if (DataTypeParseIntegerT<int>(buf, 10, 0, &arg1i, IM_S32_MIN, IM_S32_MAX)) *v = (int)ImClamp((ImS64)arg0i + arg1i, (ImS64)IM_S32_MIN, (ImS64)IM_S32_MAX); } // Add (use "+-" to subtract)
+        else if (op == '*') { if (ImParseFloat(buf, &arg1f)) *v = (int)(arg0i * arg1f); }                      // Multiply
+        else if (op == '/') { if (ImParseFloat(buf, &arg1f) && arg1f != 0.0f) *v = (int)(arg0i / arg1f); }     // Divide
+        else                { if (DataTypeParseIntegerT<int>(buf, base, wrap_size, &arg1i, IM_S32_MIN, IM_S32_MAX)) *v = arg1i; } // Assign constant
     }
     else if (data_type == ImGuiDataType_Float)
     {
-        // For floats we have to ignore format with precision (e.g. "%.2f") because sscanf doesn't take them in
-        format = "%f";
+        // For floats we ignore the format (e.g. "%.2f" precision is irrelevant when reading a value)
         float* v = (float*)p_data;
         float arg0f = *v, arg1f = 0.0f;
-        if (op && sscanf(initial_value_buf, format, &arg0f) < 1)
+        if (op && !ImParseFloat(initial_value_buf, &arg0f))
             return false;
-        if (sscanf(buf, format, &arg1f) < 1)
+        if (!ImParseFloat(buf, &arg1f))
             return false;
         if (op == '+')      { *v = arg0f + arg1f; }                    // Add (use "+-" to subtract)
         else if (op == '*') { *v = arg0f * arg1f; }                    // Multiply
@@ -1900,39 +2204,32 @@ bool ImGui::DataTypeApplyOpFromText(const char* buf, const char* initial_value_b
     }
     else if (data_type == ImGuiDataType_Double)
     {
-        format = "%lf"; // scanf differentiate float/double unlike printf which forces everything to double because of ellipsis
         double* v = (double*)p_data;
         double arg0f = *v, arg1f = 0.0;
-        if (op && sscanf(initial_value_buf, format, &arg0f) < 1)
+        if (op && !ImParseDouble(initial_value_buf, &arg0f))
             return false;
-        if (sscanf(buf, format, &arg1f) < 1)
+        if (!ImParseDouble(buf, &arg1f))
             return false;
         if (op == '+')      { *v = arg0f + arg1f; }                    // Add (use "+-" to subtract)
         else if (op == '*') { *v = arg0f * arg1f; }                    // Multiply
         else if (op == '/') { if (arg1f != 0.0f) *v = arg0f / arg1f; } // Divide
         else                { *v = arg1f; }                            // Assign constant
     }
-    else if (data_type == ImGuiDataType_U32 || data_type == ImGuiDataType_S64 || data_type == ImGuiDataType_U64)
+    else
     {
         // All other types assign constant
         // We don't bother handling support for legacy operators since they are a little too crappy. Instead we will later implement a proper expression evaluator in the future.
-        sscanf(buf, format, p_data);
-    }
-    else
-    {
-        // Small types need a 32-bit buffer to receive the result from scanf()
-        int v32;
-        sscanf(buf, format, &v32);
-        if (data_type == ImGuiDataType_S8)
-            *(ImS8*)p_data = (ImS8)ImClamp(v32, (int)IM_S8_MIN, (int)IM_S8_MAX);
-        else if (data_type == ImGuiDataType_U8)
-            *(ImU8*)p_data = (ImU8)ImClamp(v32, (int)IM_U8_MIN, (int)IM_U8_MAX);
-        else if (data_type == ImGuiDataType_S16)
-            *(ImS16*)p_data = (ImS16)ImClamp(v32, (int)IM_S16_MIN, (int)IM_S16_MAX);
-        else if (data_type == ImGuiDataType_U16)
-            *(ImU16*)p_data = (ImU16)ImClamp(v32, (int)IM_U16_MIN, (int)IM_U16_MAX);
-        else
-            IM_ASSERT(0);
+        switch (data_type)
+        {
+        case ImGuiDataType_S8:  DataTypeParseIntegerT<ImS8 >(buf, base, wrap_size, (ImS8* )p_data, IM_S8_MIN,  IM_S8_MAX);  break;
+        case ImGuiDataType_U8:  DataTypeParseIntegerT<ImU8 >(buf, base, wrap_size, (ImU8* )p_data, IM_U8_MIN,  IM_U8_MAX);  break;
+        case ImGuiDataType_S16: DataTypeParseIntegerT<ImS16>(buf, base, wrap_size, (ImS16*)p_data, IM_S16_MIN, IM_S16_MAX); break;
+        case ImGuiDataType_U16: DataTypeParseIntegerT<ImU16>(buf, base, wrap_size, (ImU16*)p_data, IM_U16_MIN, IM_U16_MAX); break;
+        case ImGuiDataType_U32: DataTypeParseIntegerT<ImU32>(buf, base, wrap_size, (ImU32*)p_data, IM_U32_MIN, IM_U32_MAX); break;
+        case ImGuiDataType_S64: DataTypeParseIntegerT<ImS64>(buf, base, wrap_size, (ImS64*)p_data, IM_S64_MIN, IM_S64_MAX); break;
+        case ImGuiDataType_U64: DataTypeParseIntegerT<ImU64>(buf, base, wrap_size, (ImU64*)p_data, IM_U64_MIN, IM_U64_MAX); break;
+        default: IM_ASSERT(0);
+        }
     }
 
     return memcmp(&data_backup, p_data, type_info->Size) != 0;
@@ -2027,10 +2324,22 @@ TYPE ImGui::RoundScalarWithFormatT(const char* format, ImGuiDataType data_type,
     const char* p = v_str;
     while (*p == ' ')
         p++;
-    if (data_type == ImGuiDataType_Float || data_type == ImGuiDataType_Double)
-        v = (TYPE)ImAtof(p);
+    if (data_type == ImGuiDataType_Float)
+    {
+        float v_f = (float)v;
+        ImParseFloat(p, &v_f);
+        v = (TYPE)v_f;
+    }
+    else if (data_type == ImGuiDataType_Double)
+    {
+        double v_d = (double)v;
+        ImParseDouble(p, &v_d);
+        v = (TYPE)v_d;
+    }
     else
+    {
         ImAtoi(p, (SIGNEDTYPE*)&v);
+    }
     return v;
 }
 
@@ -3085,6 +3394,9 @@ bool ImGui::SliderScalarN(const char* label, ImGuiDataType data_type, void* v, i
 // - ImParseFormatFindEnd() [Internal]
 // - ImParseFormatTrimDecorations() [Internal]
 // - ImParseFormatPrecision() [Internal]
+// - ImParseFormatIntegerBase() [Internal]
+// - ImParseInteger() [Internal]
+// - ImParseDouble(), ImParseFloat() [Internal]
 // - TempInputTextScalar() [Internal]
 // - InputScalar()
 // - InputScalarN()
@@ -3171,6 +3483,203 @@ int ImParseFormatPrecision(const char* fmt, int default_precision)
     return (precision == INT_MAX) ? default_precision : precision;
 }
 
+// Parse integer base back from a format string: "%X" -> 16, "%o" -> 8, "%i" -> 0 (auto-detect, same as scanf), other -> 10
+// Optionally output whether the conversion is unsigned ("%u", "%x", "%X", "%o").
+int ImParseFormatIntegerBase(const char* fmt, bool* out_is_unsigned)
+{
+    if (out_is_unsigned)
+        *out_is_unsigned = false;
+    fmt = ImParseFormatFindStart(fmt);
+    if (fmt[0] != '%')
+        return 10;
+    const char* fmt_end = ImParseFormatFindEnd(fmt);
+    const char conversion = fmt_end[-1];
+    if (out_is_unsigned)
+        *out_is_unsigned = (conversion == 'u' || conversion == 'x' || conversion == 'X' || conversion == 'o');
+    switch (conversion)
+    {
+    case 'x': case 'X': return 16;
+    case 'o':           return 8;
+    case 'i':           return 0;
+    }
+    return 10;
+}
+
+static inline bool ImCharIsSpaceForParse(char c)    { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+static inline int  ImCharToDigit(char c)            { return (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'z') ? c - 'a' + 10 : (c >= 'A' && c <= 'Z') ? c - 'A' + 10 : 99; }
+
+// Parse an integer in the given base (2..36, or 0 to auto-detect "0x" and "0" prefixes the same way as strtol()). Leading blanks are skipped.
+// We return the magnitude and sign separately so the caller can clamp to any destination type. Magnitude saturates on overflow.
+// Return a pointer past the last character read, or NULL if no digit could be read.
+const char* ImParseInteger(const char* str, int base, ImU64* out_magnitude, bool* out_negative)
+{
+    while (ImCharIsSpaceForParse(*str))
+        str++;
+    bool negative = false;
+    if (*str == '-' || *str == '+')
+        negative = (*str++ == '-');
+    if ((base == 0 || base == 16) && str[0] == '0' && (str[1] == 'x' || str[1] == 'X') && ImCharToDigit(str[2]) < 16)
+        str += 2, base = 16;
+    else if (base == 0)
+        base = (str[0] == '0') ? 8 : 10;
+
+    ImU64 v = 0;
+    const char* digits_start = str;
+    for (int digit; (digit = ImCharToDigit(*str)) < base; str++)
+        v = (v > (IM_U64_MAX - (ImU64)digit) / (ImU64)base) ? IM_U64_MAX : v * (ImU64)base + (ImU64)digit;
+    if (str == digits_start)
+        return NULL;
+    *out_magnitude = v;
+    *out_negative = negative;
+    return str;
+}
+
+// Locale independent parsing of floating-point values: '.' is always accepted as a decimal point (the locale decimal point is accepted as well,
+// since that's what vsnprintf() outputs). Values with few significant digits and a small exponent, which is what users generally type,
+// are converted exactly without going through the C runtime. Other values, as well as "inf", "nan" and hexadecimal floats, use strtod()/strtof().
+// Return a pointer past the last character read, or NULL if no number could be read.
+struct ImParseDecimalResult
+{
+    ImU64   Mantissa;           // Up to 19 significant digits
+    int     Exponent;           // Value == Mantissa * 10^Exponent
+    bool    Negative;
+    bool    Truncated;          // Non-zero digits were dropped from Mantissa
+};
+
+static char ImGetLocaleDecimalPoint()
+{
+    const char* decimal_point = localeconv()->decimal_point;
+    return (decimal_point[0] != 0 && decimal_point[1] == 0) ? decimal_point[0] : '.';
+}
+
+static const char* ImParseDecimal(const char* str, ImParseDecimalResult* out)
+{
+    out->Negative = false;
+    if (*str == '-' || *str == '+')
+        out->Negative = (*str++ == '-');
+    if (str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) // Hexadecimal floats are left to the C runtime
+        return NULL;
+    ImU64 mantissa = 0;
+    int mantissa_digits = 0, exponent = 0, digits_count = 0;
+    bool truncated = false, in_fraction = false;
+    for (;; str++)
+    {
+        const char c = *str;
+        if (c >= '0' && c <= '9')
+        {
+            digits_count++;
+            if (mantissa_digits < 19)
+            {
+                mantissa = mantissa * 10 + (ImU64)(c - '0');
+                if (mantissa != 0)
+                    mantissa_digits++;
+                if (in_fraction)
+                    exponent--;
+            }
+            else
+            {
+                truncated |= (c != '0');
+                if (!in_fraction)
+                    exponent++;
+            }
+        }
+        else if (!in_fraction && (c == '.' || (c == ',' && c == ImGetLocaleDecimalPoint()))) // Only ',' is tested against the locale so we don't call localeconv() for every number
+        {
+            in_fraction = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (digits_count == 0)
+        return NULL;
+    if ((str[0] == 'e' || str[0] == 'E') && ((str[1] >= '0' && str[1] <= '9') || ((str[1] == '-' || str[1] == '+') && str[2] >= '0' && str[2] <= '9')))
+    {
+        str++;
+        const bool exponent_negative = (*str == '-');
+        if (*str == '-' || *str == '+')
+            str++;
+        int e = 0;
+        for (; *str >= '0' && *str <= '9'; str++)
+            if (e < 100000)
+                e = e * 10 + (*str - '0');
+        exponent += exponent_negative ? -e : e;
+    }
+    out->Mantissa = mantissa;
+    out->Exponent = exponent;
+    out->Truncated = truncated;
+    return str;
+}
+
+// Slow path: copy the number to a local buffer, replacing '.' with the locale decimal point, so strtod()/strtof() work with any locale.
+static const char* ImParseDoubleOrFloatWithRuntime(const char* str, double* out_d, float* out_f)
+{
+    char buf[128];
+    const char decimal_point = ImGetLocaleDecimalPoint();
+    int len = 0;
+    for (; len < IM_ARRAYSIZE(buf) - 1; len++)
+    {
+        const char c = str[len];
+        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '+' || c == '-' || c == '.' || c == decimal_point))
+            break;
+        buf[len] = (c == '.') ? decimal_point : c;
+    }
+    buf[len] = 0;
+    char* end = NULL;
+    if (out_f)
+    {
+#if defined(_MSC_VER) && _MSC_VER < 1800
+        *out_f = (float)strtod(buf, &end);
+#else
+        *out_f = strtof(buf, &end);
+#endif
+    }
+    else
+    {
+        *out_d = strtod(buf, &end);
+    }
+    return (end == buf) ? NULL : str + (end - buf);
+}
+
+const char* ImParseDouble(const char* str, double* out)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    while (ImCharIsSpaceForParse(*str))
+        str++;
+    ImParseDecimalResult d;
+    const char* end = ImParseDecimal(str, &d);
+    if (end && !d.Truncated && (d.Mantissa == 0 || (d.Mantissa <= ((ImU64)1 << 53) && d.Exponent >= -22 && d.Exponent <= 22)))
+    {
+        // Mantissa and power of ten are both exact, so a single multiplication or division is correctly rounded
+        double v = (double)d.Mantissa;
+        if (d.Mantissa != 0)
+            v = (d.Exponent >= 0) ? v * pow10[d.Exponent] : v / pow10[-d.Exponent];
+        *out = d.Negative ? -v : v;
+        return end;
+    }
+    return ImParseDoubleOrFloatWithRuntime(str, out, NULL);
+}
+
+const char* ImParseFloat(const char* str, float* out)
+{
+    static const float pow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    while (ImCharIsSpaceForParse(*str))
+        str++;
+    ImParseDecimalResult d;
+    const char* end = ImParseDecimal(str, &d);
+    if (end && !d.Truncated && (d.Mantissa == 0 || (d.Mantissa <= ((ImU64)1 << 24) && d.Exponent >= -10 && d.Exponent <= 10)))
+    {
+        // Same as ImParseDouble() with single precision, we don't convert from double as this would round twice
+        float v = (float)d.Mantissa;
+        if (d.Mantissa != 0)
+            v = (d.Exponent >= 0) ? v * pow10[d.Exponent] : v / pow10[-d.Exponent];
+        *out = d.Negative ? -v : v;
+        return end;
+    }
+    return ImParseDoubleOrFloatWithRuntime(str, NULL, out);
+}
+
 // Create text input in place of another active widget (e.g. used when doing a CTRL+Click on drag/slider widgets)
 // FIXME: Facilitate using this in variety of other situations.
 bool ImGui::TempInputText(const ImRect& bb, ImGuiID id, const char* label, char* buf, int buf_size, ImGuiInputTextFlags flags)
@@ -5452,6 +5961,8 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - TreeViewNode()
+// - ImGuiTreeView
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -5890,10 +6401,185 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_open, ImGuiTreeNodeFlags
     return is_open;
 }
 
+bool ImGui::TreeViewNode(ImGuiTreeView* tree, int row, const char* label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(tree->UpdateFrame == g.FrameCount && "Call ImGuiTreeView::Update() once per frame before displaying rows!");
+    const int node_idx = tree->VisibleNodes[row];
+    const ImGuiTreeViewNode& node = tree->Nodes[node_idx];
+    const bool is_leaf = (node.FirstChild == -1);
+    flags |= ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_NoAutoOpenOnLog; // Children are other rows, which logging can't open
+    if (is_leaf)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+
+    // The open state is stored in the node: expose it to TreeNodeBehavior() through a storage holding only this node,
+    // so clicks, keyboard navigation and SetNextItemOpen() work as with TreeNode() without growing the window storage.
+    // The ID hashes the node index with the tree, so that several trees can be displayed in the same window.
+    const ImGuiID id = ImHashData(&node_idx, sizeof(node_idx), window->GetIDNoKeepAlive(tree));
+    KeepAliveID(id);
+    tree->TempStorage.Data.resize(0);
+    tree->TempStorage.SetInt(id, node.Open ? 1 : 0);
+    ImGuiStorage* backup_storage = window->DC.StateStorage;
+    window->DC.StateStorage = &tree->TempStorage;
+    const float indent_w = node.Depth * g.Style.IndentSpacing;
+    if (indent_w > 0.0f)
+        Indent(indent_w);
+    const bool is_open = TreeNodeBehavior(id, flags, label, NULL);
+    if (indent_w > 0.0f)
+        Unindent(indent_w);
+    window->DC.StateStorage = backup_storage;
+
+    // Rows are added/removed by the next Update(), as the caller is iterating them
+    if (!is_leaf && is_open != node.Open)
+    {
+        ImGuiTreeView::OpenRequest req = { node_idx, row, is_open };
+        tree->Requests.push_back(req);
+    }
+    return is_open;
+}
+
+int ImGuiTreeView::AddNode(int parent_node_idx, bool open)
+{
+    IM_ASSERT(parent_node_idx >= -1 && parent_node_idx < Nodes.Size);
+    const int node_idx = Nodes.Size;
+    ImGuiTreeViewNode node;
+    node.Parent = parent_node_idx;
+    node.FirstChild = node.LastChild = node.NextSibling = -1;
+    node.Depth = (parent_node_idx == -1) ? 0 : Nodes[parent_node_idx].Depth + 1;
+    node.Open = open;
+    Nodes.push_back(node);
+
+    int* first_child = (parent_node_idx == -1) ? &FirstRoot : &Nodes[parent_node_idx].FirstChild;
+    int* last_child = (parent_node_idx == -1) ? &LastRoot : &Nodes[parent_node_idx].LastChild;
+    if (*last_child == -1)
+        *first_child = node_idx;
+    else
+        Nodes[*last_child].NextSibling = node_idx;
+    *last_child = node_idx;
+    VisibleNodesDirty = true;
+    return node_idx;
+}
+
+void ImGuiTreeView::Clear()
+{
+    Nodes.clear();
+    VisibleNodes.clear();
+    FirstRoot = LastRoot = -1;
+    VisibleNodesDirty = false;
+    Requests.clear();
+    TempNodes.clear();
+}
+
+// Append the visible descendants of a node (-1: the whole tree) to 'out', in display order.
+// Depth-first without recursion: after a node come its children if it is open, otherwise its next sibling or the next sibling of its closest parent.
+static void TreeViewAddVisibleNodes(const ImGuiTreeView* tree, int node_idx, ImVector<int>* out)
+{
+    int n = (node_idx == -1) ? tree->FirstRoot : tree->Nodes[node_idx].FirstChild;
+    while (n != -1)
+    {
+        out->push_back(n);
+        const ImGuiTreeViewNode& node = tree->Nodes[n];
+        if (node.Open && node.FirstChild != -1)
+        {
+            n = node.FirstChild;
+            continue;
+        }
+        while (n != -1 && tree->Nodes[n].NextSibling == -1)
+        {
+            n = tree->Nodes[n].Parent;
+            if (n == node_idx)
+                n = -1;
+        }
+        if (n != -1)
+            n = tree->Nodes[n].NextSibling;
+    }
+}
+
+// Opening a node inserts the rows of its visible descendants after its row, closing it removes the following rows of greater depth.
+// Both cost O(rows added or removed) plus moving the rows below, which is a memmove().
+static void TreeViewSetNodeOpen(ImGuiTreeView* tree, int node_idx, bool open, int row_hint)
+{
+    ImGuiTreeViewNode& node = tree->Nodes[node_idx];
+    if (node.Open == open)
+        return;
+    node.Open = open;
+    if (tree->VisibleNodesDirty || node.FirstChild == -1 || !tree->IsNodeVisible(node_idx))
+        return;
+
+    ImVector<int>& rows = tree->VisibleNodes;
+    const int row = (row_hint >= 0 && row_hint < rows.Size && rows[row_hint] == node_idx) ? row_hint : tree->FindRow(node_idx);
+    IM_ASSERT(row != -1);
+    if (open)
+    {
+        tree->TempNodes.resize(0);
+        TreeViewAddVisibleNodes(tree, node_idx, &tree->TempNodes);
+        const int insert_count = tree->TempNodes.Size;
+        const int old_size = rows.Size;
+        rows.resize(old_size + insert_count);
+        memmove(rows.Data + row + 1 + insert_count, rows.Data + row + 1, (size_t)(old_size - row - 1) * sizeof(int));
+        memcpy(rows.Data + row + 1, tree->TempNodes.Data, (size_t)insert_count * sizeof(int));
+    }
+    else
+    {
+        int row_end = row + 1;
+        while (row_end < rows.Size && tree->Nodes[rows[row_end]].Depth > node.Depth)
+            row_end++;
+        memmove(rows.Data + row + 1, rows.Data + row_end, (size_t)(rows.Size - row_end) * sizeof(int));
+        rows.resize(rows.Size - (row_end - row - 1));
+    }
+}
+
+void ImGuiTreeView::Update()
+{
+    UpdateFrame = ImGui::GetFrameCount();
+    for (int n = 0; n < Requests.Size; n++)
+        TreeViewSetNodeOpen(this, Requests[n].NodeIdx, Requests[n].Open, Requests[n].Row);
+    Requests.resize(0);
+    if (VisibleNodesDirty)
+    {
+        VisibleNodes.resize(0);
+        TreeViewAddVisibleNodes(this, -1, &VisibleNodes);
+        VisibleNodesDirty = false;
+    }
+}
+
+void ImGuiTreeView::SetNodeOpen(int node_idx, bool open)
+{
+    TreeViewSetNodeOpen(this, node_idx, open, -1);
+}
+
+void ImGuiTreeView::SetAllNodesOpen(bool open)
+{
+    for (int n = 0; n < Nodes.Size; n++)
+        Nodes[n].Open = open;
+    VisibleNodesDirty = true;
+}
+
+bool ImGuiTreeView::IsNodeVisible(int node_idx) const
+{
+    for (int n = Nodes[node_idx].Parent; n != -1; n = Nodes[n].Parent)
+        if (!Nodes[n].Open)
+            return false;
+    return true;
+}
+
+int ImGuiTreeView::FindRow(int node_idx) const
+{
+    for (int row = 0; row < VisibleNodes.Size; row++)
+        if (VisibleNodes[row] == node_idx)
+            return row;
+    return -1;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
 // - Selectable()
+// - ImGuiSelection
 //-------------------------------------------------------------------------
 
 // Tip: pass a non-visible label (e.g. "##hello") then you can use the space to draw other text or image.
@@ -6036,13 +6722,273 @@ bool ImGui::Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags
     return false;
 }
 
-//-------------------------------------------------------------------------
-// [SECTION] Widgets: ListBox
-//-------------------------------------------------------------------------
-// - ListBox()
-// - ListBoxHeader()
-// - ListBoxFooter()
-//-------------------------------------------------------------------------
+bool ImGui::Selectable(const char* label, ImGuiSelection* selection, int item_idx, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->SkipItems)
+        return false;
+
+    const bool pressed = Selectable(label, selection->Contains(item_idx), flags, size_arg);
+    const float item_x0 = window->DC.LastItemRect.Min.x - window->Pos.x + window->Scroll.x;
+    const float item_x1 = window->DC.LastItemRect.Max.x - window->Pos.x + window->Scroll.x;
+    selection->BoxSelectItemsXNext = ImVec2(ImMin(selection->BoxSelectItemsXNext.x, item_x0), ImMax(selection->BoxSelectItemsXNext.y, item_x1));
+    if (pressed)
+    {
+        selection->ApplyClick(item_idx, g.IO.KeyCtrl, g.IO.KeyShift);
+        return true;
+    }
+
+    // Shift+Up/Down: keyboard navigation just moved to this item
+    if (g.NavJustMovedToId != 0 && g.NavJustMovedToId == window->DC.LastItemId && (g.NavJustMovedToKeyMods & ImGuiKeyModFlags_Shift))
+    {
+        selection->ApplyClick(item_idx, (g.NavJustMovedToKeyMods & ImGuiKeyModFlags_Ctrl) != 0, true);
+        return true;
+    }
+    return false;
+}
+
+// Index of the first range ending after 'item_idx'
+static int SelectionFindRangeEndingAfter(const ImVector<ImGuiSelection::Range>& ranges, int item_idx)
+{
+    int lo = 0, hi = ranges.Size;
+    while (lo < hi)
+    {
+        const int mid = lo + (hi - lo) / 2;
+        if (ranges[mid].End > item_idx)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+// Index of the first range beginning after 'item_idx'
+static int SelectionFindRangeBeginningAfter(const ImVector<ImGuiSelection::Range>& ranges, int item_idx)
+{
+    int lo = 0, hi = ranges.Size;
+    while (lo < hi)
+    {
+        const int mid = lo + (hi - lo) / 2;
+        if (ranges[mid].Begin > item_idx)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+bool ImGuiSelection::Contains(int item_idx) const
+{
+    const int range_n = SelectionFindRangeEndingAfter(Ranges, item_idx);
+    return range_n < Ranges.Size && Ranges[range_n].Begin <= item_idx;
+}
+
+// Ranges [lo, hi) overlap or touch the modified items: replace them by the 0 to 2 resulting ranges.
+void ImGuiSelection::SetRange(int item_begin, int item_end, bool selected)
+{
+    if (item_begin >= item_end)
+        return;
+    Range new_ranges[2];
+    int new_ranges_count = 0;
+    int lo, hi;
+    if (selected)
+    {
+        lo = SelectionFindRangeEndingAfter(Ranges, item_begin - 1);
+        hi = SelectionFindRangeBeginningAfter(Ranges, item_end);
+        new_ranges[0].Begin = (lo < hi) ? ImMin(item_begin, Ranges[lo].Begin) : item_begin;
+        new_ranges[0].End = (lo < hi) ? ImMax(item_end, Ranges[hi - 1].End) : item_end;
+        new_ranges_count = 1;
+    }
+    else
+    {
+        lo = SelectionFindRangeEndingAfter(Ranges, item_begin);
+        hi = SelectionFindRangeBeginningAfter(Ranges, item_end - 1);
+        if (lo >= hi)
+            return;
+        if (Ranges[lo].Begin < item_begin)
+        {
+            new_ranges[new_ranges_count].Begin = Ranges[lo].Begin;
+            new_ranges[new_ranges_count++].End = item_begin;
+        }
+        if (Ranges[hi - 1].End > item_end)
+        {
+            new_ranges[new_ranges_count].Begin = item_end;
+            new_ranges[new_ranges_count++].End = Ranges[hi - 1].End;
+        }
+    }
+
+    for (int n = lo; n < hi; n++)
+        Count -= Ranges[n].End - Ranges[n].Begin;
+    for (int n = 0; n < new_ranges_count; n++)
+        Count += new_ranges[n].End - new_ranges[n].Begin;
+    const int old_size = Ranges.Size;
+    const int size_delta = new_ranges_count - (hi - lo);
+    if (size_delta > 0)
+        Ranges.resize(old_size + size_delta);
+    if (size_delta != 0)
+        memmove(Ranges.Data + hi + size_delta, Ranges.Data + hi, (size_t)(old_size - hi) * sizeof(Range));
+    if (size_delta < 0)
+        Ranges.resize(old_size + size_delta);
+    for (int n = 0; n < new_ranges_count; n++)
+        Ranges[lo + n] = new_ranges[n];
+}
+
+void ImGuiSelection::ApplyClick(int item_idx, bool ctrl, bool shift)
+{
+    if (shift && AnchorIdx != -1)
+    {
+        if (!ctrl)
+            Clear();
+        SetRange(ImMin(AnchorIdx, item_idx), ImMax(AnchorIdx, item_idx) + 1, true);
+        return;
+    }
+    if (ctrl)
+    {
+        SetSelected(item_idx, !Contains(item_idx));
+    }
+    else
+    {
+        Clear();
+        SetSelected(item_idx, true);
+    }
+    AnchorIdx = item_idx;
+}
+
+// Box-select converts the box into a range of items with the clipper geometry: item n is at StartPosY + n * ItemsHeight
+// (or the offset stored in ImGuiListClipperHeights), so no item needs to be submitted, whatever the number of items crossed.
+// Horizontally, the box has to cross the extent of the items submitted during the last frame.
+void ImGuiSelection::Update(const ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(clipper->ItemsCount >= 0 && clipper->ItemsCount < INT_MAX && "Call Update() after ImGuiListClipper::Begin(), with a known items count!");
+    IM_ASSERT((clipper->ItemsHeight > 0.0f || clipper->Heights != NULL) && "Items height is unknown, pass it to ImGuiListClipper::Begin()!");
+    if (window->SkipItems)
+        return;
+    const int items_count = clipper->ItemsCount;
+    BoxSelectItemsX = BoxSelectItemsXNext;
+    BoxSelectItemsXNext = ImVec2(FLT_MAX, -FLT_MAX);
+
+    // Ctrl+A
+    if (g.IO.KeyCtrl && ImGui::IsKeyPressedMap(ImGuiKey_A, false) && g.ActiveId == 0 && ImGui::IsWindowFocused())
+        SelectAll(items_count);
+
+    // The list spans from the current cursor position to the right of the work rectangle, as Selectable() items do
+    const float list_height = (clipper->Heights != NULL) ? clipper->Heights->GetTotalHeight() : clipper->ItemsHeight * items_count;
+    const ImRect list_rect(window->DC.CursorPos.x, clipper->StartPosY, window->WorkRect.Max.x, clipper->StartPosY + list_height);
+
+    // Start box-select when clicking in the list. Items submitted after us can still take the click (ActiveIdAllowOverlap),
+    // in which case the box-select is canceled on the next frame. This also prevents the click from moving the window.
+    const ImGuiID id = window->GetID((void*)this);
+    const ImVec2 mouse_pos = g.IO.MousePos;
+    if (!BoxSelectActive && g.IO.MouseClicked[0] && g.HoveredWindow == window && g.ActiveId == 0 && window->InnerClipRect.Contains(mouse_pos) && list_rect.Contains(mouse_pos))
+    {
+        BoxSelectActive = true;
+        BoxSelectStartPos = ImVec2(mouse_pos.x - window->Pos.x + window->Scroll.x, mouse_pos.y - clipper->StartPosY);
+        BoxSelectBackupRanges.resize(0);
+        BoxSelectBackupCount = 0;
+        if (g.IO.KeyCtrl)
+        {
+            BoxSelectBackupRanges.resize(Ranges.Size);
+            memcpy(BoxSelectBackupRanges.Data, Ranges.Data, (size_t)Ranges.size_in_bytes());
+            BoxSelectBackupCount = Count;
+        }
+        ImGui::SetActiveID(id, window);
+        g.ActiveIdAllowOverlap = true;
+        ImGui::FocusWindow(window);
+        return;
+    }
+    if (!BoxSelectActive)
+        return;
+    if (g.ActiveId != id)
+    {
+        BoxSelectActive = false;
+        return;
+    }
+    g.ActiveIdAllowOverlap = false;
+
+    // Don't modify the selection until the mouse moved past the drag threshold, so a click in the list doesn't select anything
+    if (!ImGui::IsMouseDragPastThreshold(0))
+    {
+        if (!g.IO.MouseDown[0])
+        {
+            BoxSelectActive = false;
+            ImGui::ClearActiveID();
+        }
+        return;
+    }
+
+    // Scroll when dragging out of the window
+    const ImRect clip_rect = window->InnerClipRect;
+    if (g.IO.MouseDown[0])
+    {
+        if (mouse_pos.y < clip_rect.Min.y)
+            ImGui::SetScrollY(window, window->Scroll.y - ImFloor((clip_rect.Min.y - mouse_pos.y) * g.IO.DeltaTime * 10.0f + 1.0f));
+        else if (mouse_pos.y > clip_rect.Max.y)
+            ImGui::SetScrollY(window, window->Scroll.y + ImFloor((mouse_pos.y - clip_rect.Max.y) * g.IO.DeltaTime * 10.0f + 1.0f));
+    }
+
+    // Select the items crossed by the box, added to the selection from before the box when Ctrl was held
+    ImVec2 box_min(BoxSelectStartPos.x + window->Pos.x - window->Scroll.x, BoxSelectStartPos.y + clipper->StartPosY);
+    ImVec2 box_max = mouse_pos;
+    if (box_min.x > box_max.x) ImSwap(box_min.x, box_max.x);
+    if (box_min.y > box_max.y) ImSwap(box_min.y, box_max.y);
+    const float y0 = box_min.y - clipper->StartPosY;
+    const float y1 = box_max.y - clipper->StartPosY;
+    float items_x0 = list_rect.Min.x, items_x1 = list_rect.Max.x;
+    if (BoxSelectItemsX.x <= BoxSelectItemsX.y)
+    {
+        items_x0 = BoxSelectItemsX.x + window->Pos.x - window->Scroll.x;
+        items_x1 = BoxSelectItemsX.y + window->Pos.x - window->Scroll.x;
+    }
+    int item_begin = 0, item_end = 0;
+    if (box_max.x < items_x0 || box_min.x >= items_x1)
+    {
+        // Box entirely on the left or right of the items
+    }
+    else if (clipper->Heights != NULL)
+    {
+        if (y1 >= 0.0f && y0 < clipper->Heights->GetTotalHeight() && items_count > 0)
+        {
+            item_begin = clipper->Heights->FindItem(y0);
+            item_end = clipper->Heights->FindItem(y1) + 1;
+        }
+    }
+    else if (y1 >= 0.0f)
+    {
+        item_begin = (int)ImMin(y0 / clipper->ItemsHeight, (float)items_count);
+        item_end = (int)ImMin(y1 / clipper->ItemsHeight + 1.0f, (float)items_count);
+    }
+    item_begin = ImClamp(item_begin, 0, items_count);
+    item_end = ImClamp(item_end, item_begin, items_count);
+    Ranges.resize(BoxSelectBackupRanges.Size);
+    if (BoxSelectBackupRanges.Size > 0)
+        memcpy(Ranges.Data, BoxSelectBackupRanges.Data, (size_t)BoxSelectBackupRanges.size_in_bytes());
+    Count = BoxSelectBackupCount;
+    SetRange(item_begin, item_end, true);
+    if (!g.IO.MouseDown[0])
+    {
+        BoxSelectActive = false;
+        ImGui::ClearActiveID();
+        return;
+    }
+
+    // Draw the box over the items, which are submitted after us
+    ImDrawList* draw_list = ImGui::GetForegroundDrawList(window);
+    draw_list->PushClipRect(clip_rect.Min, clip_rect.Max);
+    draw_list->AddRectFilled(box_min, box_max, ImGui::GetColorU32(ImGuiCol_Header, 0.40f));
+    draw_list->AddRect(box_min, box_max, ImGui::GetColorU32(ImGuiCol_HeaderActive));
+    draw_list->PopClipRect();
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: ListBox
+//-------------------------------------------------------------------------
+// - ListBox()
+// - ListBoxHeader()
+// - ListBoxFooter()
+//-------------------------------------------------------------------------
 // FIXME: This is an old API. We should redesign some of it, rename ListBoxHeader->BeginListBox, ListBoxFooter->EndListBox
 // and promote using them over existing ListBox() functions, similarly to change with combo boxes.
 //-------------------------------------------------------------------------
@@ -6165,10 +7111,203 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
 // - PlotEx() [Internal]
-// - PlotLines()
-// - PlotHistogram()
+// - PlotLines(), PlotLinesDouble(), PlotLinesCached()
+// - PlotHistogram(), PlotHistogramDouble(), PlotHistogramCached()
+// - ImGuiPlotCache
 //-------------------------------------------------------------------------
 
+// Arrays passed to PlotLines()/PlotHistogram() and their variants (directly or through an ImGuiPlotCache) are recognized by PlotEx() from their getter,
+// so it can read them without an indirect call per value, and draw the min/max of the values covered by each pixel column.
+struct ImGuiPlotArrayGetterData
+{
+    const void*             Values;
+    int                     Stride;
+    ImGuiDataType           DataType;       // ImGuiDataType_Float or ImGuiDataType_Double
+    const ImGuiPlotCache*   Cache;          // Optional
+    ImGuiPlotStream*        Stream;         // Optional, owner of Values and Cache
+
+    ImGuiPlotArrayGetterData(const void* values, int stride, ImGuiDataType data_type, const ImGuiPlotCache* cache = NULL) { Values = values; Stride = stride; DataType = data_type; Cache = cache; Stream = NULL; }
+};
+
+static inline float PlotArrayGetValue(const void* values, int stride, ImGuiDataType data_type, int idx)
+{
+    const void* p = (const unsigned char*)values + (size_t)idx * stride;
+    return (data_type == ImGuiDataType_Double) ? (float)*(const double*)p : *(const float*)p;
+}
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    return PlotArrayGetValue(plot_data->Values, plot_data->Stride, plot_data->DataType, idx);
+}
+
+// Accumulate min/max of values[idx_begin..idx_end) into *out_min/*out_max.
+// NaN values are ignored: comparisons with NaN are false so they never replace the current min/max.
+static void PlotArrayAccumulateMinMax(const void* values, int stride, ImGuiDataType data_type, int idx_begin, int idx_end, float* out_min, float* out_max)
+{
+    float v_min = *out_min;
+    float v_max = *out_max;
+    int idx = idx_begin;
+    if (data_type == ImGuiDataType_Float && stride == sizeof(float))
+    {
+        const float* values_f = (const float*)values;
+#ifdef IMGUI_ENABLE_SSE
+        if (idx_end - idx >= 8)
+        {
+            // _mm_min_ps(a, b)/_mm_max_ps(a, b) return 'b' when either is NaN, so the accumulators are passed second.
+            __m128 min0 = _mm_set1_ps(v_min), min1 = min0;
+            __m128 max0 = _mm_set1_ps(v_max), max1 = max0;
+            for (; idx + 8 <= idx_end; idx += 8)
+            {
+                const __m128 a = _mm_loadu_ps(values_f + idx);
+                const __m128 b = _mm_loadu_ps(values_f + idx + 4);
+                min0 = _mm_min_ps(a, min0);
+                min1 = _mm_min_ps(b, min1);
+                max0 = _mm_max_ps(a, max0);
+                max1 = _mm_max_ps(b, max1);
+            }
+            float mins[4], maxs[4];
+            _mm_storeu_ps(mins, _mm_min_ps(min0, min1));
+            _mm_storeu_ps(maxs, _mm_max_ps(max0, max1));
+            for (int n = 0; n < 4; n++)
+            {
+                v_min = ImMin(v_min, mins[n]);
+                v_max = ImMax(v_max, maxs[n]);
+            }
+        }
+#endif
+        for (; idx < idx_end; idx++)
+        {
+            const float v = values_f[idx];
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+    }
+    else
+    {
+        for (; idx < idx_end; idx++)
+        {
+            const float v = PlotArrayGetValue(values, stride, data_type, idx);
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
+// Min/max of the plotted values [idx_begin..idx_end), which are offset by 'values_offset' in the array and wrap around.
+static void PlotArrayGetMinMax(const ImGuiPlotArrayGetterData* data, int values_count, int values_offset, int idx_begin, int idx_end, float* out_min, float* out_max)
+{
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+    int begin = (idx_begin + values_offset) % values_count;
+    int count = idx_end - idx_begin;
+    while (count > 0)
+    {
+        const int end = ImMin(begin + count, values_count);
+        if (data->Cache)
+        {
+            float cache_min, cache_max;
+            data->Cache->GetMinMax(begin, end, &cache_min, &cache_max);
+            v_min = ImMin(v_min, cache_min);
+            v_max = ImMax(v_max, cache_max);
+        }
+        else
+        {
+            PlotArrayAccumulateMinMax(data->Values, data->Stride, data->DataType, begin, end, &v_min, &v_max);
+        }
+        count -= end - begin;
+        begin = 0;
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
+// Draw the min/max envelope of a pixel column spanning [x0, x1)
+static inline void PlotRenderColumn(ImDrawList* draw_list, ImGuiPlotType plot_type, const ImRect& inner_bb, float x0, float x1, float v_min, float v_max, float scale_min, float inv_scale, float histogram_zero_line_t, ImU32 col)
+{
+    ImVec2 pos0(x0, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_max - scale_min) * inv_scale)));
+    ImVec2 pos1(x1, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_min - scale_min) * inv_scale)));
+    if (plot_type == ImGuiPlotType_Lines)
+    {
+        if (pos1.y - pos0.y < 1.0f)
+        {
+            const float y_center = (pos0.y + pos1.y) * 0.5f;
+            pos0.y = y_center - 0.5f;
+            pos1.y = y_center + 0.5f;
+        }
+    }
+    else if (plot_type == ImGuiPlotType_Histogram)
+    {
+        const float y_zero = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+        pos0.y = ImMin(pos0.y, y_zero);
+        pos1.y = ImMax(pos1.y, y_zero);
+    }
+    draw_list->PrimRect(pos0, pos1, col);
+}
+
+// Streams: columns are aligned on absolute indices of values rather than on the visible range, so the min/max of a column doesn't change
+// once all its values have been added. We keep it in the stream until the column scrolls out, and only query the cache for new columns
+// and for the partial columns at both ends.
+static void PlotStreamRenderColumns(ImDrawList* draw_list, const ImGuiPlotArrayGetterData* data, ImGuiPlotType plot_type, const ImRect& inner_bb, int res_w, int item_count, float scale_min, float inv_scale, float histogram_zero_line_t, float hovered_x, ImU32 col_base, ImU32 col_hovered)
+{
+    ImGuiPlotStream* stream = data->Stream;
+    const int values_count = stream->GetSize();
+    const int values_offset = stream->GetOffset();
+    const ImS64 values_end = stream->TotalCount;
+    const ImS64 values_begin = values_end - values_count;
+    const int lines = (plot_type == ImGuiPlotType_Lines) ? 1 : 0; // Lines columns share their boundary value with the next column
+    const int column_size = (item_count + res_w - 1) / res_w;
+    const int slots_count = res_w + 2;
+    if (stream->ColumnsValuesCount != column_size || stream->ColumnsIdx.Size != slots_count)
+    {
+        stream->ColumnsValuesCount = column_size;
+        stream->ColumnsIdx.resize(slots_count);
+        stream->ColumnsMinMax.resize(slots_count);
+        for (int n = 0; n < slots_count; n++)
+            stream->ColumnsIdx[n] = -1;
+    }
+
+    const ImS64 column_first = values_begin / column_size;
+    const ImS64 column_last = (values_end - 1 - lines) / column_size;
+    const int columns_max = (int)(column_last - column_first + 1);
+    const float x_scale = (inner_bb.Max.x - inner_bb.Min.x) / item_count;
+    draw_list->PrimReserve(columns_max * 6, columns_max * 4);
+    int columns_drawn = 0;
+    int column_begin = (int)(column_first * column_size - values_begin); // Index of the first value of the column, relative to the first plotted value
+    int slot = (int)(column_first % slots_count);
+    for (ImS64 column = column_first; column <= column_last; column++, column_begin += column_size, slot = (slot + 1 < slots_count) ? slot + 1 : 0)
+    {
+        const int idx0 = ImMax(column_begin, 0);
+        const int idx1 = ImMin(column_begin + column_size + lines, values_count);
+        const bool complete = (column_begin >= 0 && column_begin + column_size + lines <= values_count);
+        ImVec2 v_min_max;
+        if (complete && stream->ColumnsIdx[slot] == column)
+        {
+            v_min_max = stream->ColumnsMinMax[slot];
+        }
+        else
+        {
+            PlotArrayGetMinMax(data, values_count, values_offset, idx0, idx1, &v_min_max.x, &v_min_max.y);
+            if (complete)
+            {
+                stream->ColumnsIdx[slot] = column;
+                stream->ColumnsMinMax[slot] = v_min_max;
+            }
+        }
+        if (v_min_max.x > v_min_max.y) // Only NaN values
+            continue;
+
+        const float x0 = inner_bb.Min.x + idx0 * x_scale;
+        const float x1 = inner_bb.Min.x + ImMin(column_begin + column_size, item_count) * x_scale;
+        const bool column_hovered = (hovered_x >= x0 && hovered_x < x1);
+        PlotRenderColumn(draw_list, plot_type, inner_bb, x0, x1, v_min_max.x, v_min_max.y, scale_min, inv_scale, histogram_zero_line_t, column_hovered ? col_hovered : col_base);
+        columns_drawn++;
+    }
+    draw_list->PrimUnreserve((columns_max - columns_drawn) * 6, (columns_max - columns_drawn) * 4);
+}
+
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
 {
     ImGuiContext& g = *GImGui;
@@ -6192,19 +7331,27 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     if (!ItemAdd(total_bb, 0, &frame_bb))
         return -1;
     const bool hovered = ItemHoverable(frame_bb, id);
+    const ImGuiPlotArrayGetterData* array_data = (values_getter == &Plot_ArrayGetter) ? (const ImGuiPlotArrayGetterData*)data : NULL;
 
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (array_data != NULL && values_count > 0)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            PlotArrayGetMinMax(array_data, values_count, 0, 0, values_count, &v_min, &v_max);
+        }
+        else
+        {
+            for (int i = 0; i < values_count; i++)
+            {
+                const float v = values_getter(data, i);
+                if (v != v) // Ignore NaN values
+                    continue;
+                v_min = ImMin(v_min, v);
+                v_max = ImMax(v_max, v);
+            }
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -6216,6 +7363,7 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
 
     const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
+    int column_hovered = -1;
     if (values_count >= values_count_min)
     {
         int res_w = ImMin((int)frame_size.x, values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
@@ -6235,6 +7383,7 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             else if (plot_type == ImGuiPlotType_Histogram)
                 SetTooltip("%d: %8.4g", v_idx, v0);
             idx_hovered = v_idx;
+            column_hovered = (int)(t * res_w);
         }
 
         const float t_step = 1.0f / (float)res_w;
@@ -6248,6 +7397,36 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
+        // Arrays with more values than pixel columns: draw the min/max envelope of the values covered by each column,
+        // instead of sampling one value per column which would miss peaks. Lines columns share their boundary value so the envelope stays connected.
+        // Without levels of detail this reads every value, even with a fixed scale: use an ImGuiPlotCache to plot large arrays in O(graph width).
+        const bool decimate = (array_data != NULL && item_count > res_w);
+        if (decimate && array_data->Stream != NULL)
+        {
+            PlotStreamRenderColumns(window->DrawList, array_data, plot_type, inner_bb, res_w, item_count, scale_min, inv_scale, histogram_zero_line_t, (column_hovered >= 0) ? g.IO.MousePos.x : -FLT_MAX, col_base, col_hovered);
+            res_w = 0; // Skip regular rendering below
+        }
+        else if (decimate)
+        {
+            window->DrawList->PrimReserve(res_w * 6, res_w * 4);
+            int columns_drawn = 0;
+            for (int n = 0; n < res_w; n++)
+            {
+                const int idx0 = (int)((ImS64)n * item_count / res_w);
+                const int idx1 = (int)((ImS64)(n + 1) * item_count / res_w);
+                float v_min, v_max;
+                PlotArrayGetMinMax(array_data, values_count, values_offset, idx0, (plot_type == ImGuiPlotType_Lines) ? idx1 + 1 : idx1, &v_min, &v_max);
+                if (v_min > v_max) // Only NaN values
+                    continue;
+                const float x0 = ImLerp(inner_bb.Min.x, inner_bb.Max.x, n * t_step);
+                const float x1 = ImLerp(inner_bb.Min.x, inner_bb.Max.x, (n + 1) * t_step);
+                PlotRenderColumn(window->DrawList, plot_type, inner_bb, x0, x1, v_min, v_max, scale_min, inv_scale, histogram_zero_line_t, (n == column_hovered) ? col_hovered : col_base);
+                columns_drawn++;
+            }
+            window->DrawList->PrimUnreserve((res_w - columns_drawn) * 6, (res_w - columns_drawn) * 4);
+            res_w = 0; // Skip regular rendering below
+        }
+
         for (int n = 0; n < res_w; n++)
         {
             const float t1 = t0 + t_step;
@@ -6287,27 +7466,41 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
+static void PlotStream(ImGuiPlotType plot_type, const char* label, ImGuiPlotStream* stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
 {
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
+    // Use the incremental min/max of the stream rather than letting PlotEx() scan the values
+    if (scale_min == FLT_MAX && stream->MinQueueSize > 0)
+        scale_min = stream->GetMin();
+    if (scale_max == FLT_MAX && stream->MaxQueueSize > 0)
+        scale_max = stream->GetMax();
+    ImGuiPlotArrayGetterData data(stream->Values.Data, sizeof(float), ImGuiDataType_Float, &stream->Cache);
+    data.Stream = stream;
+    ImGui::PlotEx(plot_type, label, &Plot_ArrayGetter, (void*)&data, stream->GetSize(), stream->GetOffset(), overlay_text, scale_min, scale_max, graph_size);
+}
 
-static float Plot_ArrayGetter(void* data, int idx)
+void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
+    ImGuiPlotArrayGetterData data(values, stride, ImGuiDataType_Float);
+    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
-void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+void ImGui::PlotLinesDouble(const char* label, const double* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
-    ImGuiPlotArrayGetterData data(values, stride);
+    ImGuiPlotArrayGetterData data(values, stride, ImGuiDataType_Double);
     PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLinesCached(const char* label, const ImGuiPlotCache* cache, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    ImGuiPlotArrayGetterData data(cache->Values, cache->Stride, cache->DataType, cache);
+    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, cache->ValuesCount, values_offset, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotLines(const char* label, ImGuiPlotStream* stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotStream(ImGuiPlotType_Lines, label, stream, overlay_text, scale_min, scale_max, graph_size);
+}
+
 void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
 {
     PlotEx(ImGuiPlotType_Lines, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
@@ -6315,15 +7508,249 @@ void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int
 
 void ImGui::PlotHistogram(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
-    ImGuiPlotArrayGetterData data(values, stride);
+    ImGuiPlotArrayGetterData data(values, stride, ImGuiDataType_Float);
+    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogramDouble(const char* label, const double* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+{
+    ImGuiPlotArrayGetterData data(values, stride, ImGuiDataType_Double);
     PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotHistogramCached(const char* label, const ImGuiPlotCache* cache, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    ImGuiPlotArrayGetterData data(cache->Values, cache->Stride, cache->DataType, cache);
+    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, cache->ValuesCount, values_offset, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, ImGuiPlotStream* stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotStream(ImGuiPlotType_Histogram, label, stream, overlay_text, scale_min, scale_max, graph_size);
+}
+
 void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
 {
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+// Each level stores the min/max of blocks of PLOT_CACHE_BLOCK_SIZE elements of the level below (level -1 being the values).
+// A range query only visits the partial blocks at both ends of each level, so it costs O(log(values_count)) whatever its size.
+#define PLOT_CACHE_BLOCK_SIZE 8
+
+static int PlotCacheGetLevelSize(const ImGuiPlotCache* cache, int level)
+{
+    if (level < 0)
+        return cache->ValuesCount;
+    const int level_end = (level + 1 < cache->LevelsOffsets.Size) ? cache->LevelsOffsets[level + 1] : cache->Levels.Size;
+    return level_end - cache->LevelsOffsets[level];
+}
+
+// Recompute the blocks [block_begin, block_end) of a level from the level below
+static void PlotCacheUpdateBlocks(ImGuiPlotCache* cache, int level, int block_begin, int block_end)
+{
+    const int src_count = PlotCacheGetLevelSize(cache, level - 1);
+    ImVec2* blocks = cache->Levels.Data + cache->LevelsOffsets[level];
+    for (int n = block_begin; n < block_end; n++)
+    {
+        const int src_begin = n * PLOT_CACHE_BLOCK_SIZE;
+        const int src_end = ImMin(src_begin + PLOT_CACHE_BLOCK_SIZE, src_count);
+        ImVec2 block(FLT_MAX, -FLT_MAX);
+        if (level == 0)
+        {
+            PlotArrayAccumulateMinMax(cache->Values, cache->Stride, cache->DataType, src_begin, src_end, &block.x, &block.y);
+        }
+        else
+        {
+            const ImVec2* src_blocks = cache->Levels.Data + cache->LevelsOffsets[level - 1];
+            for (int src_n = src_begin; src_n < src_end; src_n++)
+            {
+                block.x = ImMin(block.x, src_blocks[src_n].x);
+                block.y = ImMax(block.y, src_blocks[src_n].y);
+            }
+        }
+        blocks[n] = block;
+    }
+}
+
+static void PlotCacheBuild(ImGuiPlotCache* cache, const void* values, int values_count, int stride, ImGuiDataType data_type)
+{
+    cache->Clear();
+    cache->Values = values;
+    cache->ValuesCount = values_count;
+    cache->Stride = stride;
+    cache->DataType = data_type;
+
+    int levels_size = 0;
+    for (int count = values_count; count > PLOT_CACHE_BLOCK_SIZE; count = (count + PLOT_CACHE_BLOCK_SIZE - 1) / PLOT_CACHE_BLOCK_SIZE)
+    {
+        cache->LevelsOffsets.push_back(levels_size);
+        levels_size += (count + PLOT_CACHE_BLOCK_SIZE - 1) / PLOT_CACHE_BLOCK_SIZE;
+    }
+    cache->Levels.resize(levels_size);
+    for (int level = 0; level < cache->LevelsOffsets.Size; level++)
+        PlotCacheUpdateBlocks(cache, level, 0, PlotCacheGetLevelSize(cache, level));
+}
+
+void ImGuiPlotCache::Build(const float* values, int values_count, int stride)
+{
+    PlotCacheBuild(this, values, values_count, stride, ImGuiDataType_Float);
+}
+
+void ImGuiPlotCache::Build(const double* values, int values_count, int stride)
+{
+    PlotCacheBuild(this, values, values_count, stride, ImGuiDataType_Double);
+}
+
+void ImGuiPlotCache::Clear()
+{
+    Values = NULL;
+    ValuesCount = 0;
+    Levels.clear();
+    LevelsOffsets.clear();
+}
+
+void ImGuiPlotCache::Update(int idx_begin, int idx_end)
+{
+    IM_ASSERT(idx_begin >= 0 && idx_end <= ValuesCount);
+    int begin = idx_begin, end = idx_end;
+    for (int level = 0; level < LevelsOffsets.Size && begin < end; level++)
+    {
+        begin = begin / PLOT_CACHE_BLOCK_SIZE;
+        end = (end + PLOT_CACHE_BLOCK_SIZE - 1) / PLOT_CACHE_BLOCK_SIZE;
+        PlotCacheUpdateBlocks(this, level, begin, end);
+    }
+}
+
+void ImGuiPlotCache::GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_end <= ValuesCount);
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+
+    // Process the partial blocks at both ends of [begin, end) with the current level, then move to the next level with the
+    // range of its whole blocks. [begin, end) are in units of values, aligned on the size of blocks of the current level.
+    int begin = idx_begin, end = idx_end;
+    int level = -1, block_size = 1;
+    while (begin < end)
+    {
+        const int next_block_size = block_size * PLOT_CACHE_BLOCK_SIZE;
+        int inner_begin = (begin + next_block_size - 1) / next_block_size * next_block_size;
+        int inner_end = end / next_block_size * next_block_size;
+        if (level + 1 >= LevelsOffsets.Size || inner_begin >= inner_end)
+            inner_begin = inner_end = end; // Last level: process the whole range
+        if (level < 0)
+        {
+            PlotArrayAccumulateMinMax(Values, Stride, DataType, begin, inner_begin, &v_min, &v_max);
+            PlotArrayAccumulateMinMax(Values, Stride, DataType, inner_end, end, &v_min, &v_max);
+        }
+        else
+        {
+            const ImVec2* blocks = Levels.Data + LevelsOffsets[level];
+            for (int n = begin / block_size; n < inner_begin / block_size; n++)
+            {
+                v_min = ImMin(v_min, blocks[n].x);
+                v_max = ImMax(v_max, blocks[n].y);
+            }
+            for (int n = inner_end / block_size; n < end / block_size; n++)
+            {
+                v_min = ImMin(v_min, blocks[n].x);
+                v_max = ImMax(v_max, blocks[n].y);
+            }
+        }
+        begin = inner_begin;
+        end = inner_end;
+        level++;
+        block_size = next_block_size;
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
+void ImGuiPlotStream::SetCapacity(int capacity)
+{
+    IM_ASSERT(capacity > 0);
+    Values.resize(capacity);
+    memset(Values.Data, 0, (size_t)Values.size_in_bytes());
+    MinQueue.resize(capacity);
+    MaxQueue.resize(capacity);
+    Cache.Build(Values.Data, Values.Size);
+    Clear();
+}
+
+void ImGuiPlotStream::Clear()
+{
+    TotalCount = 0;
+    MinQueueFront = MinQueueSize = 0;
+    MaxQueueFront = MaxQueueSize = 0;
+    ColumnsIdx.clear();
+    ColumnsMinMax.clear();
+    ColumnsValuesCount = 0;
+}
+
+// Sliding window min (max), after writing a new value at Values[ring_idx]: drop the overwritten value, which can only be at the front
+// of the queue, then the values which can't be the min (max) anymore from its back, as the new value is smaller (larger) and will stay
+// longer in the buffer. O(1) amortized per value.
+static inline void PlotStreamQueuePush(const ImGuiPlotStream* stream, ImVector<int>& queue, int& front, int& size, int ring_idx, bool keep_larger)
+{
+    const int capacity = stream->Values.Size;
+    if (size > 0 && queue.Data[front] == ring_idx)
+    {
+        front = (front + 1 < capacity) ? front + 1 : 0;
+        size--;
+    }
+    const float v = stream->Values.Data[ring_idx];
+    if (v != v) // Ignore NaN values
+        return;
+    while (size > 0)
+    {
+        int back = front + size - 1;
+        if (back >= capacity)
+            back -= capacity;
+        const float back_v = stream->Values.Data[queue.Data[back]];
+        if (keep_larger ? (back_v > v) : (back_v < v))
+            break;
+        size--;
+    }
+    int push = front + size;
+    if (push >= capacity)
+        push -= capacity;
+    queue.Data[push] = ring_idx;
+    size++;
+}
+
+void ImGuiPlotStream::AddValues(const float* values, int values_count)
+{
+    const int capacity = Values.Size;
+    IM_ASSERT(capacity > 0 && "Call SetCapacity() first!");
+    if (values_count >= capacity)
+    {
+        // Only the last 'capacity' values will remain
+        values += values_count - capacity;
+        TotalCount += values_count - capacity;
+        values_count = capacity;
+        MinQueueSize = MaxQueueSize = 0;
+    }
+
+    const int ring_begin = (int)(TotalCount % capacity);
+    int ring_n = ring_begin;
+    for (int n = 0; n < values_count; n++)
+    {
+        Values.Data[ring_n] = values[n];
+        PlotStreamQueuePush(this, MinQueue, MinQueueFront, MinQueueSize, ring_n, false);
+        PlotStreamQueuePush(this, MaxQueue, MaxQueueFront, MaxQueueSize, ring_n, true);
+        if (++ring_n == capacity)
+            ring_n = 0;
+    }
+    TotalCount += values_count;
+
+    // Update the levels of detail of the range we wrote into
+    const int ring_end = ring_begin + values_count;
+    Cache.Update(ring_begin, ImMin(ring_end, capacity));
+    if (ring_end > capacity)
+        Cache.Update(0, ring_end - capacity);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
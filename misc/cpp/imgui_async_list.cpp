@@ -0,0 +1,308 @@
+// dear imgui: asynchronous data source for clipped lists, fetching rows on worker threads, using C++11 <thread>
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiAsyncList.
+
+#include "imgui.h"
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+#include "imgui_async_list.h"
+
+static void WorkerThreadMain(ImGuiAsyncList* list)
+{
+    const int page_bytes = list->PageSize * list->RowSize;
+    std::unique_lock<std::mutex> lock(list->Mutex);
+    while (true)
+    {
+        list->CondQueued.wait(lock, [list] { return list->Exit || list->QueueNext < list->Queue.Size; });
+        if (list->Exit)
+            return;
+        const int slot = list->Queue[list->QueueNext++];
+        ImGuiAsyncListPage& page = list->Pages[slot];
+        page.Fetching = true;
+        const int row_begin = page.PageIdx * list->PageSize;
+        const int row_end = ImMin(row_begin + list->PageSize, list->RowsCount);
+        unsigned char* out_rows = list->PagesData.Data + (size_t)slot * page_bytes;
+        lock.unlock();
+        list->FetchFunc(list->UserData, row_begin, row_end, out_rows);
+        lock.lock();
+        list->Completed.push_back(slot);
+    }
+}
+
+ImGuiAsyncList::ImGuiAsyncList()
+{
+    RowsCount = RowSize = PageSize = 0;
+    FetchFunc = NULL;
+    UserData = NULL;
+    QueueNext = 0;
+    Generation = 0;
+    VisibleBegin = INT_MAX;
+    VisibleEnd = PrevVisibleBegin = -1;
+    ScrollSpeed = 0.0f;
+    LatencyFrames = 1.0f;
+    MissingRowsCount = MissingRowsCountNext = 0;
+    FetchedPagesCount = 0;
+    Exit = false;
+}
+
+ImGuiAsyncList::~ImGuiAsyncList()
+{
+    IM_ASSERT(Threads.empty() && "Forgot to call Shutdown()?");
+}
+
+void ImGuiAsyncList::Init(int rows_count, int row_size, ImGuiAsyncListFetchFunc fetch_func, void* user_data, int threads_count, int page_size, int max_pages)
+{
+    IM_ASSERT(FetchFunc == NULL && "Already initialized!");
+    IM_ASSERT(fetch_func != NULL && row_size > 0 && page_size > 0 && max_pages > 0);
+    RowsCount = rows_count;
+    RowSize = row_size;
+    PageSize = page_size;
+    FetchFunc = fetch_func;
+    UserData = user_data;
+
+    ImGuiAsyncListPage free_page;
+    free_page.PageIdx = -1;
+    free_page.State = ImGuiAsyncListPageState_Free;
+    free_page.Fetching = false;
+    free_page.Generation = free_page.RequestFrame = free_page.LastUsedFrame = 0;
+    Pages.resize(max_pages, free_page);
+    PagesData.resize(max_pages * page_size * row_size);
+    Queue.reserve(max_pages);
+    Completed.reserve(max_pages); // So worker threads never allocate
+
+    for (int n = 0; n < threads_count; n++)
+        Threads.emplace_back(WorkerThreadMain, this);
+}
+
+void ImGuiAsyncList::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Exit = true;
+    }
+    CondQueued.notify_all();
+    for (size_t n = 0; n < Threads.size(); n++)
+        Threads[n].join();
+    Threads.clear();
+    Exit = false;
+
+    Pages.clear();
+    PagesData.clear();
+    PagesMap.Clear();
+    Queue.clear();
+    Completed.clear();
+    QueueNext = 0;
+    FetchFunc = NULL;
+}
+
+// Call with Mutex locked
+static void InvalidatePages(ImGuiAsyncList* list)
+{
+    list->Generation++;
+    for (int n = 0; n < list->Pages.Size; n++)
+        if (!list->Pages[n].Fetching)
+        {
+            list->Pages[n].PageIdx = -1;
+            list->Pages[n].State = ImGuiAsyncListPageState_Free;
+        }
+    list->PagesMap.Clear();
+    list->Queue.resize(0);
+    list->QueueNext = 0;
+}
+
+void ImGuiAsyncList::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    InvalidatePages(this);
+}
+
+void ImGuiAsyncList::SetRowsCount(int rows_count)
+{
+    if (RowsCount == rows_count)
+        return;
+    std::lock_guard<std::mutex> lock(Mutex); // Worker threads read RowsCount to clamp the page they fetch
+    InvalidatePages(this);
+    RowsCount = rows_count;
+}
+
+// Find a slot for a new page: a free slot, or the least recently used ready page which wasn't used or wanted this frame.
+static int AllocatePage(ImGuiAsyncList* list, int frame_count)
+{
+    int best_slot = -1;
+    for (int n = 0; n < list->Pages.Size; n++)
+    {
+        const ImGuiAsyncListPage& page = list->Pages[n];
+        if (page.State == ImGuiAsyncListPageState_Free && !page.Fetching)
+            return n;
+        if (page.State == ImGuiAsyncListPageState_Ready && page.LastUsedFrame < frame_count)
+            if (best_slot == -1 || page.LastUsedFrame < list->Pages[best_slot].LastUsedFrame)
+                best_slot = n;
+    }
+    if (best_slot != -1)
+        list->PagesMap.SetInt((ImGuiID)list->Pages[best_slot].PageIdx, 0);
+    return best_slot;
+}
+
+// Request a page if it isn't loaded or requested yet, and mark it as wanted for this frame. Return false if the cache is full.
+static bool RequestPage(ImGuiAsyncList* list, int page_idx, int frame_count)
+{
+    int slot = list->PagesMap.GetInt((ImGuiID)page_idx) - 1;
+    if (slot < 0)
+    {
+        slot = AllocatePage(list, frame_count);
+        if (slot < 0)
+            return false;
+        ImGuiAsyncListPage& page = list->Pages[slot];
+        page.PageIdx = page_idx;
+        page.State = ImGuiAsyncListPageState_Requested;
+        page.Generation = list->Generation;
+        page.RequestFrame = frame_count;
+        page.LastUsedFrame = -1;
+        list->PagesMap.SetInt((ImGuiID)page_idx, slot + 1);
+    }
+    ImGuiAsyncListPage& page = list->Pages[slot];
+    if (page.LastUsedFrame == frame_count)
+        return true; // Already requested this frame: prefetch ranges overlap, and a slot queued twice would be fetched again while being read.
+    page.LastUsedFrame = frame_count;
+    if (page.State == ImGuiAsyncListPageState_Requested && !page.Fetching)
+        list->Queue.push_back(slot);
+    return true;
+}
+
+const void* ImGuiAsyncList::GetRow(int row_n)
+{
+    IM_ASSERT(row_n >= 0 && row_n < RowsCount);
+    VisibleBegin = ImMin(VisibleBegin, row_n);
+    VisibleEnd = ImMax(VisibleEnd, row_n + 1);
+
+    const int frame_count = ImGui::GetFrameCount();
+    const int page_idx = row_n / PageSize;
+    int slot = PagesMap.GetInt((ImGuiID)page_idx) - 1;
+    if (slot < 0 && Threads.empty())
+    {
+        // No worker threads: fetch synchronously
+        slot = AllocatePage(this, frame_count);
+        if (slot >= 0)
+        {
+            ImGuiAsyncListPage& page = Pages[slot];
+            page.PageIdx = page_idx;
+            PagesMap.SetInt((ImGuiID)page_idx, slot + 1);
+            const int row_begin = page_idx * PageSize;
+            FetchFunc(UserData, row_begin, ImMin(row_begin + PageSize, RowsCount), PagesData.Data + (size_t)slot * PageSize * RowSize);
+            page.State = ImGuiAsyncListPageState_Ready;
+            FetchedPagesCount++;
+        }
+    }
+    if (slot >= 0 && Pages[slot].State == ImGuiAsyncListPageState_Ready)
+    {
+        Pages[slot].LastUsedFrame = frame_count;
+        return PagesData.Data + ((size_t)slot * PageSize + (row_n - page_idx * PageSize)) * RowSize;
+    }
+    MissingRowsCountNext++;
+    return NULL;
+}
+
+void ImGuiAsyncList::Update()
+{
+    IM_ASSERT(FetchFunc != NULL && "Call Init() first!");
+    const int frame_count = ImGui::GetFrameCount();
+    std::unique_lock<std::mutex> lock(Mutex);
+
+    // Collect fetched pages
+    for (int n = 0; n < Completed.Size; n++)
+    {
+        ImGuiAsyncListPage& page = Pages[Completed[n]];
+        page.Fetching = false;
+        if (page.Generation != Generation)
+        {
+            page.PageIdx = -1;
+            page.State = ImGuiAsyncListPageState_Free;
+            continue;
+        }
+        page.State = ImGuiAsyncListPageState_Ready;
+        LatencyFrames = ImLerp(LatencyFrames, (float)(frame_count - page.RequestFrame), 0.2f);
+        FetchedPagesCount++;
+    }
+    Completed.resize(0);
+
+    // Requested pages which weren't picked by a worker thread yet are dropped, unless requested again below
+    for (int n = QueueNext; n < Queue.Size; n++)
+    {
+        ImGuiAsyncListPage& page = Pages[Queue[n]];
+        page.LastUsedFrame = -1;
+    }
+    Queue.resize(0);
+    QueueNext = 0;
+
+    if (VisibleBegin < VisibleEnd && RowsCount > 0 && !Threads.empty())
+    {
+        // Predict where the visible range is heading
+        if (PrevVisibleBegin >= 0)
+            ScrollSpeed = ImLerp(ScrollSpeed, (float)(VisibleBegin - PrevVisibleBegin), 0.3f);
+        PrevVisibleBegin = VisibleBegin;
+        const int pages_count = (RowsCount + PageSize - 1) / PageSize;
+        const int visible_rows = VisibleEnd - VisibleBegin;
+        const int ahead_rows = (int)(ImFabs(ScrollSpeed) * (LatencyFrames + 1.0f));
+        const int page_first = VisibleBegin / PageSize;
+        const int page_last = (VisibleEnd - 1) / PageSize;
+        const int pages_ahead = (ahead_rows + PageSize - 1) / PageSize;
+        const int pages_around = (visible_rows + PageSize - 1) / PageSize;
+        const int dir = (ScrollSpeed < 0.0f) ? -1 : +1;
+
+        bool cache_full = false;
+        for (int page_idx = page_first; page_idx <= page_last && !cache_full; page_idx++)
+            cache_full = !RequestPage(this, page_idx, frame_count);
+        for (int n = 1; n <= pages_ahead && !cache_full; n++)
+        {
+            const int page_idx = (dir > 0) ? page_last + n : page_first - n;
+            if (page_idx >= 0 && page_idx < pages_count)
+                cache_full = !RequestPage(this, page_idx, frame_count);
+        }
+        for (int n = 1; n <= pages_around && !cache_full; n++)
+        {
+            if (page_last + n < pages_count)
+                cache_full = !RequestPage(this, page_last + n, frame_count);
+            if (page_first - n >= 0 && !cache_full)
+                cache_full = !RequestPage(this, page_first - n, frame_count);
+        }
+    }
+    VisibleBegin = INT_MAX;
+    VisibleEnd = -1;
+    MissingRowsCount = MissingRowsCountNext;
+    MissingRowsCountNext = 0;
+
+    // Free requested pages which aren't wanted anymore
+    for (int n = 0; n < Pages.Size; n++)
+    {
+        ImGuiAsyncListPage& page = Pages[n];
+        if (page.State == ImGuiAsyncListPageState_Requested && !page.Fetching && page.LastUsedFrame != frame_count)
+        {
+            PagesMap.SetInt((ImGuiID)page.PageIdx, 0);
+            page.PageIdx = -1;
+            page.State = ImGuiAsyncListPageState_Free;
+        }
+    }
+
+    lock.unlock();
+    CondQueued.notify_all();
+}
+
+void ImGuiAsyncList::RenderPlaceholder(float width)
+{
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+    if (width <= 0.0f)
+        width = ImMax(ImGui::GetContentRegionAvail().x * 0.5f, 1.0f);
+    const float line_height = ImGui::GetTextLineHeight();
+    const ImRect bb(window->DC.CursorPos, window->DC.CursorPos + ImVec2(width, line_height));
+    ImGui::ItemSize(bb);
+    if (!ImGui::ItemAdd(bb, 0))
+        return;
+    const float bar_height = ImFloor(line_height * 0.6f);
+    const ImVec2 bar_min(bb.Min.x, ImFloor(bb.Min.y + (line_height - bar_height) * 0.5f));
+    window->DrawList->AddRectFilled(bar_min, ImVec2(bb.Max.x, bar_min.y + bar_height), ImGui::GetColorU32(ImGuiCol_FrameBg), ImGui::GetStyle().FrameRounding);
+}
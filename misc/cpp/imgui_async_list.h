@@ -0,0 +1,110 @@
+// dear imgui: asynchronous data source for clipped lists, fetching rows on worker threads, using C++11 <thread>
+// For large lists backed by a slow data source (database, network, files) which the UI thread should never wait for.
+
+// Usage:
+//   static ImGuiAsyncList list;
+//   list.Init(rows_count, sizeof(MyRow), MyFetchRows, &my_db);     // Once. MyFetchRows(&my_db, row_begin, row_end, out_rows) runs on a worker thread.
+//   [...]
+//   ImGuiListClipper clipper;
+//   clipper.Begin(list.RowsCount);
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           if (const MyRow* row = (const MyRow*)list.GetRow(row_n))
+//               ImGui::Text("%s", row->Name);
+//           else
+//               list.RenderPlaceholder();                        // Not loaded yet
+//   list.Update();                                               // Once per frame, after accessing rows: schedule fetches
+//   [...]
+//   list.Shutdown();                                             // Before the ImGuiAsyncList and the data source are destroyed.
+
+// Rows are fetched by pages of consecutive rows into a bounded cache of pages, least recently used pages being evicted first.
+// Update() requests, in order of priority:
+// - the pages of the rows accessed with GetRow() this frame (the visible range reported by the clipper),
+// - the pages ahead in the direction of scrolling, as far as the scrolling speed extrapolated over the measured fetch latency,
+// - one screen of rows above and below, so Page Up/Page Down and keyboard navigation find rows ready.
+// Requests which aren't wanted anymore (e.g. scrolled past) are dropped before being fetched.
+// Worker threads only call the fetch function, they never call ImGui:: functions. With 0 threads, GetRow() fetches the page of a
+// missing row synchronously (so it never returns NULL unless the cache is full of pages accessed this frame), and Update() doesn't request pages.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiAsyncList.
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Worker thread: write the rows [row_begin, row_end) into 'out_rows', (row_end - row_begin) * row_size bytes.
+typedef void (*ImGuiAsyncListFetchFunc)(void* user_data, int row_begin, int row_end, void* out_rows);
+
+enum ImGuiAsyncListPageState
+{
+    ImGuiAsyncListPageState_Free,
+    ImGuiAsyncListPageState_Requested,
+    ImGuiAsyncListPageState_Ready
+};
+
+struct ImGuiAsyncListPage
+{
+    int                     PageIdx;                // Rows [PageIdx * PageSize, (PageIdx + 1) * PageSize), -1 when free
+    ImGuiAsyncListPageState State;                  // Only accessed by the UI thread
+    bool                    Fetching;               // Set while a worker thread writes the rows. Protected by Mutex.
+    int                     Generation;             // Value of ImGuiAsyncList::Generation when requested, older results are discarded
+    int                     RequestFrame;
+    int                     LastUsedFrame;
+};
+
+struct ImGuiAsyncList
+{
+    int                         RowsCount;          // Written under Mutex (read by worker threads), use SetRowsCount()
+    int                         RowSize;            // Size of a row in bytes
+    int                         PageSize;           // Number of rows fetched together
+    ImGuiAsyncListFetchFunc     FetchFunc;
+    void*                       UserData;
+
+    ImVector<ImGuiAsyncListPage> Pages;             // Cache slots
+    ImVector<unsigned char>     PagesData;          // Rows of Pages[n] are at PagesData[n * PageSize * RowSize]
+    ImGuiStorage                PagesMap;           // Page index -> slot index + 1. Only accessed by the UI thread.
+    ImVector<int>               Queue;              // Slots to fetch, in order of priority. Protected by Mutex.
+    int                         QueueNext;          // Protected by Mutex.
+    ImVector<int>               Completed;          // Slots fetched since the last Update(). Protected by Mutex.
+    int                         Generation;
+
+    int                         VisibleBegin;       // Range of rows accessed with GetRow() since the last Update()
+    int                         VisibleEnd;
+    int                         PrevVisibleBegin;
+    float                       ScrollSpeed;        // Rows per frame, smoothed
+    float                       LatencyFrames;      // Frames between requesting a page and having it ready, smoothed
+    int                         MissingRowsCount;   // Rows accessed with GetRow() but not loaded yet, during the last frame
+    int                         MissingRowsCountNext;
+    int                         FetchedPagesCount;  // Statistics
+
+    std::vector<std::thread>    Threads;
+    std::mutex                  Mutex;
+    std::condition_variable     CondQueued;
+    bool                        Exit;               // Protected by Mutex.
+
+    ImGuiAsyncList();
+    ~ImGuiAsyncList();
+
+    // Start worker threads. 'max_pages' bounds the memory used by rows: max_pages * page_size * row_size bytes.
+    IMGUI_API void          Init(int rows_count, int row_size, ImGuiAsyncListFetchFunc fetch_func, void* user_data, int threads_count = 1, int page_size = 64, int max_pages = 64);
+
+    // Stop worker threads (waiting for fetches in progress) and free memory.
+    IMGUI_API void          Shutdown();
+
+    // UI thread: discard all loaded rows (e.g. the data source changed). Fetches in progress are discarded when they complete.
+    IMGUI_API void          Invalidate();
+    IMGUI_API void          SetRowsCount(int rows_count);   // Also invalidate
+
+    // UI thread: return the row, or NULL if it isn't loaded yet (with 0 threads: fetch it now). Valid until the next call to Update().
+    IMGUI_API const void*   GetRow(int row_n);
+
+    // UI thread, once per frame after GetRow() calls: collect fetched pages, update predictions and request pages.
+    IMGUI_API void          Update();
+
+    // UI thread: draw a placeholder bar of the height of a line of text, for a row which isn't loaded yet. width <= 0.0f: half of the available width.
+    IMGUI_API void          RenderPlaceholder(float width = 0.0f);
+};
@@ -0,0 +1,280 @@
+// dear imgui: job windows, recording the contents of some windows on worker threads, using C++11 <thread>
+// Requires '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in imconfig.h to use worker threads (see imgui_internal.h).
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiJobWindow, ImGuiJobWindows.
+
+#include "imgui.h"
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+#include "imgui_job_windows.h"
+
+//-----------------------------------------------------------------------------
+// ImGuiJobWindow
+//-----------------------------------------------------------------------------
+
+ImGuiJobWindow::ImGuiJobWindow()
+{
+    Ctx = NULL;
+    Func = NULL;
+    UserData = NULL;
+    HostWindow = NULL;
+    FrameSubmitted = -1;
+    HostFocused = false;
+}
+
+ImGuiJobWindow::~ImGuiJobWindow()
+{
+    DestroyContext();
+}
+
+void ImGuiJobWindow::DestroyContext()
+{
+    if (Ctx == NULL)
+        return;
+    ImGuiContext* backup_ctx = ImGui::GetCurrentContext();
+    ImGui::SetCurrentContext(Ctx); // So memory is accounted to the right context
+    ImGui::DestroyContext(Ctx);
+    ImGui::SetCurrentContext(backup_ctx != Ctx ? backup_ctx : NULL);
+    Ctx = NULL;
+    HostWindow = NULL;
+    FrameSubmitted = -1;
+}
+
+// Record a whole frame of the job context. Called from a worker thread, or from the main thread when helping/running serially.
+static void RunJob(ImGuiJobWindow* job)
+{
+    ImGuiContext* backup_ctx = ImGui::GetCurrentContext();
+    ImGui::SetCurrentContext(job->Ctx);
+    ImGuiContext& g = *job->Ctx;
+
+    ImGui::NewFrame();
+
+    // Follow the focus of the host window
+    if (!job->HostFocused && g.NavWindow != NULL)
+        ImGui::FocusWindow(NULL);
+    else if (job->HostFocused && g.NavWindow == NULL)
+        ImGui::SetNextWindowFocus();
+
+    const ImGuiWindowFlags flags = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoBackground | ImGuiWindowFlags_NoBringToFrontOnFocus;
+    ImGui::SetNextWindowPos(job->Pos);
+    ImGui::SetNextWindowSize(job->Size);
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.0f);
+    ImGui::Begin("##JobWindow", NULL, flags);
+    ImGui::PopStyleVar(2);
+    job->Func(job->UserData);
+    ImGui::End();
+    ImGui::Render();
+
+    ImGui::SetCurrentContext(backup_ctx);
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiJobWindows
+//-----------------------------------------------------------------------------
+
+static void WorkerThreadMain(ImGuiJobWindows* jw)
+{
+    std::unique_lock<std::mutex> lock(jw->Mutex);
+    while (true)
+    {
+        jw->CondJobQueued.wait(lock, [jw] { return jw->Exit || jw->JobsNext < jw->Jobs.Size; });
+        if (jw->Exit)
+            return;
+        ImGuiJobWindow* job = jw->Jobs[jw->JobsNext++];
+        jw->JobsRunning++;
+        lock.unlock();
+        RunJob(job);
+        lock.lock();
+        jw->JobsRunning--;
+        jw->CondJobDone.notify_all();
+    }
+}
+
+static void StopWorkerThreads(ImGuiJobWindows* jw)
+{
+    {
+        std::lock_guard<std::mutex> lock(jw->Mutex);
+        jw->Exit = true;
+    }
+    jw->CondJobQueued.notify_all();
+    for (size_t n = 0; n < jw->Threads.size(); n++)
+        jw->Threads[n].join();
+    jw->Threads.clear();
+    jw->Exit = false;
+}
+
+ImGuiJobWindows::ImGuiJobWindows()
+{
+    MainCtx = NULL;
+    JobsNext = JobsRunning = 0;
+    Exit = false;
+}
+
+ImGuiJobWindows::~ImGuiJobWindows()
+{
+    IM_ASSERT(MainCtx == NULL && "Forgot to call Shutdown()?");
+    StopWorkerThreads(this);
+}
+
+void ImGuiJobWindows::Init(int threads_count)
+{
+    IM_ASSERT(MainCtx == NULL && "Already initialized!");
+    MainCtx = ImGui::GetCurrentContext();
+    IM_ASSERT(MainCtx != NULL);
+#ifndef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    IM_ASSERT(threads_count == 0 && "Worker threads require IMGUI_USE_THREAD_LOCAL_CONTEXT, as each thread needs its own current context.");
+    threads_count = 0;
+#endif
+
+    ImGuiContextHook hook;
+    hook.Type = ImGuiContextHookType_EndFramePre;
+    hook.Callback = [](ImGuiContext*, ImGuiContextHook* hook) { ((ImGuiJobWindows*)hook->UserData)->WaitAndMerge(); };
+    hook.UserData = this;
+    ImGui::AddContextHook(MainCtx, &hook);
+
+    for (int n = 0; n < threads_count; n++)
+        Threads.emplace_back(WorkerThreadMain, this);
+}
+
+void ImGuiJobWindows::Shutdown()
+{
+    if (MainCtx == NULL)
+        return;
+    StopWorkerThreads(this);
+    Jobs.clear();
+    JobsNext = JobsRunning = 0;
+
+    ImGuiContext& g = *MainCtx;
+    for (int n = g.Hooks.Size - 1; n >= 0; n--)
+        if (g.Hooks[n].UserData == this)
+            g.Hooks.erase(g.Hooks.Data + n);
+    MainCtx = NULL;
+}
+
+void ImGuiJobWindows::Submit(ImGuiJobWindow* job, ImGuiJobWindowFunc func, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(&g == MainCtx && "Submit() must be called with the main context current.");
+    IM_ASSERT(func != NULL);
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->SkipItems)
+        return;
+
+    // Reserve the remaining content region with an item: clicking in it won't move the host window,
+    // and while it is active (e.g. dragging a slider of the job window) we keep forwarding mouse inputs.
+    ImVec2 pos = window->DC.CursorPos;
+    ImVec2 size = ImMax(ImGui::GetContentRegionAvail(), ImVec2(1.0f, 1.0f));
+    ImGui::PushID(job);
+    ImGui::InvisibleButton("##JobWindow", size);
+    ImGui::PopID();
+    const bool mouse_inputs = (g.HoveredWindow == window) || ImGui::IsItemActive();
+    const bool keyboard_inputs = (g.NavWindow == window);
+
+    if (job->Ctx == NULL)
+    {
+        job->Ctx = ImGui::CreateContext(g.IO.Fonts);
+        job->Ctx->IO.IniFilename = NULL;
+        job->Ctx->IO.LogFilename = NULL;
+    }
+    IM_ASSERT(job->Ctx->IO.Fonts == g.IO.Fonts);
+    IM_ASSERT(job->FrameSubmitted != g.FrameCount && "Job window submitted twice in the same frame!");
+    job->FrameSubmitted = g.FrameCount;
+
+    // Setup inputs of the job context (from the main thread, before the job is queued)
+    const ImGuiIO& io = g.IO;
+    ImGuiIO& job_io = job->Ctx->IO;
+    job_io.DisplaySize = io.DisplaySize;
+    job_io.DeltaTime = io.DeltaTime;
+    job_io.BackendFlags = io.BackendFlags;
+    job_io.FontGlobalScale = io.FontGlobalScale;
+    job_io.FontDefault = io.FontDefault;
+    job_io.MouseDoubleClickTime = io.MouseDoubleClickTime;
+    job_io.MouseDoubleClickMaxDist = io.MouseDoubleClickMaxDist;
+    job_io.MouseDragThreshold = io.MouseDragThreshold;
+    job_io.KeyRepeatDelay = io.KeyRepeatDelay;
+    job_io.KeyRepeatRate = io.KeyRepeatRate;
+    job_io.ConfigMacOSXBehaviors = io.ConfigMacOSXBehaviors;
+    job_io.ConfigInputTextCursorBlink = io.ConfigInputTextCursorBlink;
+    memcpy(job_io.KeyMap, io.KeyMap, sizeof(io.KeyMap));
+    if (mouse_inputs)
+    {
+        job_io.MousePos = io.MousePos;
+        memcpy(job_io.MouseDown, io.MouseDown, sizeof(io.MouseDown));
+        job_io.MouseWheel = io.MouseWheel;
+        job_io.MouseWheelH = io.MouseWheelH;
+    }
+    else
+    {
+        job_io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+        memset(job_io.MouseDown, 0, sizeof(job_io.MouseDown));
+        job_io.MouseWheel = job_io.MouseWheelH = 0.0f;
+    }
+    if (keyboard_inputs)
+    {
+        job_io.KeyCtrl = io.KeyCtrl;
+        job_io.KeyShift = io.KeyShift;
+        job_io.KeyAlt = io.KeyAlt;
+        job_io.KeySuper = io.KeySuper;
+        memcpy(job_io.KeysDown, io.KeysDown, sizeof(io.KeysDown));
+        job_io.InputQueueCharacters.resize(io.InputQueueCharacters.Size);
+        if (io.InputQueueCharacters.Size > 0)
+            memcpy(job_io.InputQueueCharacters.Data, io.InputQueueCharacters.Data, io.InputQueueCharacters.size_in_bytes());
+    }
+    else
+    {
+        job_io.KeyCtrl = job_io.KeyShift = job_io.KeyAlt = job_io.KeySuper = false;
+        memset(job_io.KeysDown, 0, sizeof(job_io.KeysDown));
+        job_io.InputQueueCharacters.resize(0);
+    }
+    job->Ctx->Style = g.Style;
+
+    job->Func = func;
+    job->UserData = user_data;
+    job->HostWindow = window;
+    job->Pos = pos;
+    job->Size = size;
+    job->HostFocused = keyboard_inputs;
+
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Jobs.push_back(job);
+    }
+    CondJobQueued.notify_one();
+}
+
+void ImGuiJobWindows::WaitAndMerge()
+{
+    ImGuiContext& g = *MainCtx;
+    IM_ASSERT(GImGui == &g);
+
+    // Run jobs which haven't been picked by a worker thread yet, rather than sleeping. With 0 threads this runs all the jobs.
+    std::unique_lock<std::mutex> lock(Mutex);
+    while (JobsNext < Jobs.Size)
+    {
+        ImGuiJobWindow* job = Jobs[JobsNext++];
+        JobsRunning++;
+        lock.unlock();
+        RunJob(job);
+        lock.lock();
+        JobsRunning--;
+    }
+    CondJobDone.wait(lock, [this] { return JobsRunning == 0; });
+
+    // Attach draw lists to host windows, in submission order.
+    // As jobs are submitted between Begin()/End() of their host window, this is the order of Begin() calls.
+    for (int job_n = 0; job_n < Jobs.Size; job_n++)
+    {
+        ImGuiJobWindow* job = Jobs[job_n];
+        ImDrawData* draw_data = &job->Ctx->DrawData;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            job->HostWindow->DrawListsAppended.push_back(draw_data->CmdLists[n]);
+        if (g.HoveredWindow == job->HostWindow && job->Ctx->MouseCursor != ImGuiMouseCursor_Arrow)
+            g.MouseCursor = job->Ctx->MouseCursor;
+    }
+    Jobs.resize(0);
+    JobsNext = 0;
+}
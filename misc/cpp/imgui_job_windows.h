@@ -0,0 +1,89 @@
+// dear imgui: job windows, recording the contents of some windows on worker threads, using C++11 <thread>
+// Requires '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in imconfig.h to use worker threads (see imgui_internal.h).
+
+// A job window fills the remaining content region of a regular "host" window. Its contents are submitted by a function which
+// runs on a worker thread, with its own ImGuiContext, while the main thread carries on with the rest of the frame.
+// Before EndFrame() the main thread waits for all jobs and renders the draw lists of each job right after the draw list of
+// its host window, so the output only depends on the order of Begin() calls, never on the timing of threads.
+
+// Usage:
+//   static ImGuiJobWindows job_windows;
+//   job_windows.Init(4);                            // Once, after ImGui::CreateContext() and building the font atlas.
+//   static ImGuiJobWindow job_window;               // One per job window, persistent (it owns the ImGuiContext of the job).
+//   [...]
+//   ImGui::Begin("My Panel");
+//   job_windows.Submit(&job_window, MyPanelContents, &my_panel_data); // Call MyPanelContents(&my_panel_data) on a worker thread.
+//   ImGui::End();
+//   [...]
+//   ImGui::Render();                                // Waits for jobs (from an EndFrame hook).
+//   job_windows.Shutdown();                         // Before ImGui::DestroyContext(), and before destroying ImGuiJobWindow instances.
+
+// Restrictions, as the contents of a job window are recorded concurrently with the main thread and other jobs:
+// - The job function may only call ImGui:: functions and access data that nobody modifies until the end of the frame.
+//   It cannot submit to other windows of the main context nor talk to other jobs. Begin()/End() are called for it.
+// - Child windows, popups and tooltips opened by the job are rendered along with the job window (at the depth of the host window).
+// - Job windows receive mouse inputs while their host window is hovered (or while they own an active item),
+//   and keyboard inputs while their host window is focused. The io.WantCaptureXXX/io.WantTextInput flags of the main context
+//   don't reflect what happens in job windows. Job contexts use their own (default) clipboard functions, assign thread-safe
+//   functions to job->Ctx->IO.GetClipboardTextFn/SetClipboardTextFn to share the clipboard of your application.
+// - The font atlas is shared, see "Sharing a font atlas" in imgui.h.
+// - Without IMGUI_USE_THREAD_LOCAL_CONTEXT, or with 0 worker threads, jobs run one after another on the main thread before EndFrame().
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiJobWindow, ImGuiJobWindows.
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct ImGuiWindow;
+
+typedef void (*ImGuiJobWindowFunc)(void* user_data);
+
+struct ImGuiJobWindow
+{
+    ImGuiContext*       Ctx;                        // Context recording the job window (created on first Submit, owned)
+    ImGuiJobWindowFunc  Func;
+    void*               UserData;
+    ImGuiWindow*        HostWindow;                 // Window of the main context which will render the job window
+    ImVec2              Pos;                        // Screen position and size of the job window, in the coordinates of the main context
+    ImVec2              Size;
+    int                 FrameSubmitted;             // Frame count of the main context at the last Submit()
+    bool                HostFocused;
+
+    ImGuiJobWindow();
+    ~ImGuiJobWindow();
+    IMGUI_API void      DestroyContext();           // Free the job context. Call when no job is running.
+};
+
+struct ImGuiJobWindows
+{
+    ImGuiContext*               MainCtx;
+    std::vector<std::thread>    Threads;
+    std::mutex                  Mutex;
+    std::condition_variable     CondJobQueued;
+    std::condition_variable     CondJobDone;
+    ImVector<ImGuiJobWindow*>   Jobs;               // Jobs submitted this frame, in submission order. Protected by Mutex.
+    int                         JobsNext;           // Index of the next job to run in Jobs[]. Protected by Mutex.
+    int                         JobsRunning;        // Protected by Mutex.
+    bool                        Exit;               // Protected by Mutex.
+
+    ImGuiJobWindows();
+    ~ImGuiJobWindows();
+
+    // Start worker threads for the current context, which becomes the main context. 0 threads runs all jobs on the main thread.
+    IMGUI_API void      Init(int threads_count);
+
+    // Stop worker threads and remove our hook from the main context.
+    IMGUI_API void      Shutdown();
+
+    // Main thread, between Begin()/End() of the host window: reserve the remaining content region and queue a job to fill it.
+    IMGUI_API void      Submit(ImGuiJobWindow* job, ImGuiJobWindowFunc func, void* user_data);
+
+    // Main thread: help running the queued jobs, wait for all of them and attach their draw lists to their host windows.
+    // Called automatically at the beginning of EndFrame().
+    IMGUI_API void      WaitAndMerge();
+};
@@ -0,0 +1,416 @@
+// dear imgui: log console for high volumes of lines, with bounded memory, incremental filtering and appends from any thread, using C++11 <mutex>
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiLogConsole.
+
+#include "imgui.h"
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+#include "imgui_log_console.h"
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+ImGuiLogConsole::ImGuiLogConsole(int max_bytes, int chunk_size)
+{
+    IM_ASSERT(chunk_size > 1 && max_bytes > 0);
+    ChunkSize = chunk_size;
+    MaxChunks = ImMax(max_bytes / chunk_size, 2);
+    Chunks.resize(MaxChunks, NULL);
+    ChunksBegin = ChunksEnd = ChunkUsed = 0;
+    LinesBegin = 0;
+    FirstLine = 0;
+    FilterPrevBuf[0] = 0;
+    FilteredBegin = 0;
+    FilterScanNext = 0;
+    FilterRefineNext = 0;
+    FilterTimeBudget = 0.004f;
+    AutoScroll = true;
+    RowsDropped = 0;
+    ChildWindowId = 0;
+    PendingDroppedLines = PendingDroppedLinesCopy = 0;
+}
+
+ImGuiLogConsole::~ImGuiLogConsole()
+{
+    for (int n = 0; n < Chunks.Size; n++)
+        IM_FREE(Chunks[n]);
+}
+
+// Start a new pending block, recycling the oldest one when there are too many: the UI thread didn't call Update() for a while,
+// and those lines would have been dropped from the chunks anyway. Called with the mutex held: O(1) once blocks are allocated.
+static void NewPendingBlock(ImGuiLogConsole* log)
+{
+    if ((int)log->Pending.size() >= log->MaxChunks)
+    {
+        log->PendingDroppedLines += log->Pending.front().LinesCount;
+        log->PendingFreeBlocks.push_back(std::move(log->Pending.front()));
+        log->Pending.pop_front();
+    }
+    if (log->PendingFreeBlocks.empty())
+    {
+        log->Pending.emplace_back();
+        log->Pending.back().Text.reserve((size_t)log->ChunkSize);
+    }
+    else
+    {
+        log->Pending.push_back(std::move(log->PendingFreeBlocks.back()));
+        log->PendingFreeBlocks.pop_back();
+    }
+    log->Pending.back().Text.clear();
+    log->Pending.back().LinesCount = 0;
+}
+
+void ImGuiLogConsole::AddText(const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    const bool add_new_line = (text == text_end || text_end[-1] != '\n');
+    const size_t text_size = (size_t)(text_end - text) + (add_new_line ? 1 : 0);
+
+    // Keep the lines of a text in a single block when it fits, so the UI thread rarely has to join a line across blocks
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Pending.empty() || (Pending.back().Text.size() + text_size > (size_t)ChunkSize && !Pending.back().Text.empty()))
+        NewPendingBlock(this);
+    while (text < text_end)
+    {
+        if (Pending.back().Text.size() == (size_t)ChunkSize)
+            NewPendingBlock(this);
+        PendingBlock& block = Pending.back();
+        const size_t copy_size = ImMin((size_t)(text_end - text), (size_t)ChunkSize - block.Text.size());
+        block.Text.insert(block.Text.end(), text, text + copy_size);
+        for (const char* p = text; (p = (const char*)memchr(p, '\n', (size_t)(text + copy_size - p))) != NULL; p++)
+            block.LinesCount++;
+        text += copy_size;
+    }
+    if (add_new_line)
+    {
+        if (Pending.back().Text.size() == (size_t)ChunkSize)
+            NewPendingBlock(this);
+        Pending.back().Text.push_back('\n');
+        Pending.back().LinesCount++;
+    }
+}
+
+void ImGuiLogConsole::AddLog(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    AddLogV(fmt, args);
+    va_end(args);
+}
+
+void ImGuiLogConsole::AddLogV(const char* fmt, va_list args)
+{
+    // Format before taking the lock
+    char buf[1024];
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const int len = vsnprintf(buf, IM_ARRAYSIZE(buf), fmt, args);
+    if (len >= 0 && len < IM_ARRAYSIZE(buf))
+    {
+        AddText(buf, buf + len);
+    }
+    else if (len > 0)
+    {
+        std::vector<char> buf_large((size_t)len + 1);
+        vsnprintf(buf_large.data(), buf_large.size(), fmt, args_copy);
+        AddText(buf_large.data(), buf_large.data() + len);
+    }
+    va_end(args_copy);
+}
+
+void ImGuiLogConsole::Clear()
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        while (!Pending.empty())
+        {
+            PendingFreeBlocks.push_back(std::move(Pending.front()));
+            Pending.pop_front();
+        }
+        PendingDroppedLines = 0;
+    }
+    PendingDroppedLinesCopy = 0;
+    RowsDropped += Filter.IsActive() ? (FilteredLines.Size - FilteredBegin) : (int)GetLinesCount();
+    ChunksBegin = ChunksEnd = ChunkUsed = 0;
+    Lines.resize(0);
+    LinesBegin = 0;
+    FirstLine = 0;
+    FilteredLines.resize(0);
+    FilteredBegin = 0;
+    FilterScanNext = 0;
+    FilterRefineSource.resize(0);
+    FilterRefineNext = 0;
+}
+
+void ImGuiLogConsole::GetLine(ImS64 line_no, const char** out_begin, const char** out_end) const
+{
+    IM_ASSERT(line_no >= FirstLine && line_no < GetEndLine());
+    const Line& line = Lines[LinesBegin + (int)(line_no - FirstLine)];
+    *out_begin = Chunks[line.Chunk % MaxChunks] + line.Offset;
+    *out_end = *out_begin + line.Length;
+}
+
+// Start a new chunk, recycling the oldest one and its lines when all chunks are used
+static void NewChunk(ImGuiLogConsole* log)
+{
+    if (log->ChunksEnd - log->ChunksBegin == log->MaxChunks)
+    {
+        while (log->LinesBegin < log->Lines.Size && log->Lines[log->LinesBegin].Chunk == log->ChunksBegin)
+        {
+            log->LinesBegin++;
+            log->FirstLine++;
+        }
+        log->ChunksBegin++;
+        if (log->LinesBegin >= 1024 && log->LinesBegin >= log->Lines.Size / 2)
+        {
+            log->Lines.erase(log->Lines.Data, log->Lines.Data + log->LinesBegin);
+            log->LinesBegin = 0;
+        }
+    }
+    char*& chunk = log->Chunks[log->ChunksEnd % log->MaxChunks];
+    if (chunk == NULL)
+        chunk = (char*)IM_ALLOC((size_t)log->ChunkSize);
+    log->ChunksEnd++;
+    log->ChunkUsed = 0;
+}
+
+static void AddLine(ImGuiLogConsole* log, const char* text, int len)
+{
+    len = ImMin(len, log->ChunkSize - 1);
+    if (log->ChunksBegin == log->ChunksEnd || log->ChunkUsed + len + 1 > log->ChunkSize)
+        NewChunk(log);
+    char* dst = log->Chunks[(log->ChunksEnd - 1) % log->MaxChunks] + log->ChunkUsed;
+    memcpy(dst, text, (size_t)len);
+    dst[len] = '\n';
+    ImGuiLogConsole::Line line;
+    line.Chunk = log->ChunksEnd - 1;
+    line.Offset = log->ChunkUsed;
+    line.Length = len;
+    log->Lines.push_back(line);
+    log->ChunkUsed += len + 1;
+}
+
+// The results of 'filter' are a subset of the results of 'prev_filter' when it extends a single positive term, e.g. "err" -> "error".
+// An inactive filter matches everything, and extending a "-excluded" term matches more lines.
+static bool IsFilterExtension(const char* prev_filter, const char* filter)
+{
+    const size_t prev_len = strlen(prev_filter);
+    if (strncmp(prev_filter, filter, prev_len) != 0 || strchr(filter, ',') != NULL)
+        return false;
+    while (*prev_filter == ' ' || *prev_filter == '\t')
+        prev_filter++;
+    return *prev_filter != 0 && *prev_filter != '-';
+}
+
+void ImGuiLogConsole::Update()
+{
+    // Parse lines appended by all threads, outside of the mutex. Every text ends with a '\n', so no line continues after the last block.
+    // The UI thread takes the mutex once per frame: to recycle the blocks parsed during the last frame, and take the new ones.
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        while (!PendingSwap.empty())
+        {
+            PendingFreeBlocks.push_back(std::move(PendingSwap.front()));
+            PendingSwap.pop_front();
+        }
+        Pending.swap(PendingSwap);
+        PendingDroppedLinesCopy = PendingDroppedLines;
+    }
+    const ImS64 first_line_before = FirstLine;
+    for (size_t block_n = 0; block_n < PendingSwap.size(); block_n++)
+    {
+        const std::vector<char>& text = PendingSwap[block_n].Text;
+        for (const char* p = text.data(), *p_end = p + text.size(); p < p_end; )
+        {
+            const char* line_end = (const char*)memchr(p, '\n', (size_t)(p_end - p));
+            if (line_end == NULL)
+            {
+                PendingCarry.insert(PendingCarry.end(), p, p_end);
+                break;
+            }
+            if (!PendingCarry.empty())
+            {
+                PendingCarry.insert(PendingCarry.end(), p, line_end);
+                AddLine(this, PendingCarry.data(), (int)PendingCarry.size());
+                PendingCarry.clear();
+            }
+            else
+            {
+                AddLine(this, p, (int)(line_end - p));
+            }
+            p = line_end + 1;
+        }
+    }
+    PendingCarry.clear();
+
+    // Restart or refine the filter results when the filter changed
+    if (strcmp(Filter.InputBuf, FilterPrevBuf) != 0)
+    {
+        if (Filter.IsActive() && IsFilterExtension(FilterPrevBuf, Filter.InputBuf))
+        {
+            // Results so far, and previous results left to refine, are tested again
+            const int remaining = FilterRefineSource.Size - FilterRefineNext;
+            if (remaining > 0)
+            {
+                const int old_size = FilteredLines.Size;
+                FilteredLines.resize(old_size + remaining);
+                memcpy(FilteredLines.Data + old_size, FilterRefineSource.Data + FilterRefineNext, (size_t)remaining * sizeof(ImS64));
+            }
+            FilteredLines.swap(FilterRefineSource);
+            FilterRefineNext = FilteredBegin;
+        }
+        else
+        {
+            FilterRefineSource.resize(0);
+            FilterRefineNext = 0;
+            FilterScanNext = FirstLine;
+        }
+        RowsDropped = 0;
+        FilteredLines.resize(0);
+        FilteredBegin = 0;
+        if (Filter.IsActive())
+            FilteredLines.reserve(FilterRefineSource.Size > 0 ? FilterRefineSource.Size - FilterRefineNext : (int)GetLinesCount()); // Growing while filtering millions of lines would copy them
+        ImStrncpy(FilterPrevBuf, Filter.InputBuf, IM_ARRAYSIZE(FilterPrevBuf));
+    }
+
+    if (!Filter.IsActive())
+    {
+        RowsDropped += (int)(FirstLine - first_line_before);
+        return;
+    }
+
+    // Forget results of dropped lines
+    const int filtered_begin_before = FilteredBegin;
+    while (FilteredBegin < FilteredLines.Size && FilteredLines[FilteredBegin] < FirstLine)
+        FilteredBegin++;
+    RowsDropped += FilteredBegin - filtered_begin_before;
+    if (FilteredBegin >= 1024 && FilteredBegin >= FilteredLines.Size / 2)
+    {
+        FilteredLines.erase(FilteredLines.Data, FilteredLines.Data + FilteredBegin);
+        FilteredBegin = 0;
+    }
+    FilterScanNext = ImMax(FilterScanNext, FirstLine);
+
+    // Test lines within the time budget, checking the time every 256 lines
+    const std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now() + std::chrono::microseconds((int)(FilterTimeBudget * 1000000.0f));
+    const char* line_begin;
+    const char* line_end;
+    while (FilterRefineNext < FilterRefineSource.Size)
+    {
+        const int batch_end = ImMin(FilterRefineNext + 256, FilterRefineSource.Size);
+        for (; FilterRefineNext < batch_end; FilterRefineNext++)
+        {
+            const ImS64 line_no = FilterRefineSource[FilterRefineNext];
+            if (line_no < FirstLine)
+                continue;
+            GetLine(line_no, &line_begin, &line_end);
+            if (Filter.PassFilter(line_begin, line_end))
+                FilteredLines.push_back(line_no);
+        }
+        if (std::chrono::steady_clock::now() >= time_end)
+            break;
+    }
+    if (FilterRefineNext < FilterRefineSource.Size)
+        return;
+    FilterRefineSource.resize(0);
+    FilterRefineNext = 0;
+
+    const ImS64 end_line = GetEndLine();
+    while (FilterScanNext < end_line)
+    {
+        const ImS64 batch_end = ImMin(FilterScanNext + 256, end_line);
+        for (; FilterScanNext < batch_end; FilterScanNext++)
+        {
+            GetLine(FilterScanNext, &line_begin, &line_end);
+            if (Filter.PassFilter(line_begin, line_end))
+                FilteredLines.push_back(FilterScanNext);
+        }
+        if (std::chrono::steady_clock::now() >= time_end)
+            break;
+    }
+}
+
+void ImGuiLogConsole::Draw(const char* title, bool* p_open)
+{
+    if (!ImGui::Begin(title, p_open))
+    {
+        ImGui::End();
+        Update();
+        return;
+    }
+    DrawContents();
+    ImGui::End();
+}
+
+void ImGuiLogConsole::DrawContents()
+{
+    if (ImGui::BeginPopup("Options"))
+    {
+        ImGui::Checkbox("Auto-scroll", &AutoScroll);
+        ImGui::EndPopup();
+    }
+    if (ImGui::Button("Options"))
+        ImGui::OpenPopup("Options");
+    ImGui::SameLine();
+    const bool clear = ImGui::Button("Clear");
+    ImGui::SameLine();
+    Filter.Draw("Filter", -100.0f);
+
+    Update();
+    if (clear)
+        Clear();
+
+    const bool filter_active = Filter.IsActive();
+    const int rows_count = filter_active ? (FilteredLines.Size - FilteredBegin) : (int)GetLinesCount();
+    const ImS64 pending_dropped_lines = PendingDroppedLinesCopy;
+    if (filter_active)
+        ImGui::Text("%d matching lines out of %d", rows_count, (int)GetLinesCount());
+    else
+        ImGui::Text("%d lines", rows_count);
+    if (FirstLine + pending_dropped_lines > 0)
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%lld older lines dropped)", (long long)(FirstLine + pending_dropped_lines));
+    }
+    if (filter_active && IsFiltering())
+    {
+        ImGui::SameLine();
+        const float progress = (FilterRefineNext < FilterRefineSource.Size) ? (float)FilterRefineNext / FilterRefineSource.Size : (float)(FilterScanNext - FirstLine) / ImMax(GetLinesCount(), (ImS64)1);
+        ImGui::TextDisabled("Filtering... %d%%", (int)(progress * 100.0f));
+    }
+    ImGui::Separator();
+
+    // Keep showing the same lines when the ones above them are dropped, unless following the bottom
+    const float line_height = ImGui::GetTextLineHeight();
+    bool scroll_to_bottom = false;
+    if (ImGuiWindow* child_window = ImGui::FindWindowByID(ChildWindowId))
+    {
+        scroll_to_bottom = AutoScroll && child_window->Scroll.y >= child_window->ScrollMax.y;
+        if (RowsDropped > 0 && !scroll_to_bottom)
+            ImGui::SetScrollY(child_window, ImMax(child_window->Scroll.y - RowsDropped * line_height, 0.0f));
+    }
+    RowsDropped = 0;
+
+    ImGui::BeginChild("scrolling", ImVec2(0.0f, 0.0f), false, ImGuiWindowFlags_HorizontalScrollbar);
+    ChildWindowId = ImGui::GetCurrentWindow()->ID;
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 0.0f));
+    ImGuiListClipper clipper;
+    clipper.Begin(rows_count, line_height);
+    const char* line_begin;
+    const char* line_end;
+    while (clipper.Step())
+        for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+        {
+            GetLine(filter_active ? FilteredLines[FilteredBegin + row_n] : FirstLine + row_n, &line_begin, &line_end);
+            ImGui::TextUnformatted(line_begin, line_end);
+        }
+    clipper.End();
+    ImGui::PopStyleVar();
+    if (scroll_to_bottom)
+        ImGui::SetScrollHereY(1.0f);
+    ImGui::EndChild();
+}
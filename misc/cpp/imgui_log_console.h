@@ -0,0 +1,95 @@
+// dear imgui: log console for high volumes of lines, with bounded memory, incremental filtering and appends from any thread, using C++11 <mutex>
+// A scalable version of the demo's ExampleAppLog (see imgui_demo.cpp), for millions of lines.
+
+// Usage:
+//   static ImGuiLogConsole log;                                    // Default to 64 MB of text
+//   log.AddLog("[%05d] Hello from thread %d\n", frame, thread_n);  // Any thread. Each call adds one or more complete lines.
+//   [...]
+//   log.Draw("Log");                                               // UI thread, once per frame: Begin() + filter bar + clipped lines + End()
+
+// Storage:
+// - Text is stored in a ring of fixed size chunks. When all chunks are used, the oldest chunk is recycled with its lines,
+//   so memory is bounded by MaxChunks * ChunkSize bytes of text, plus 12 bytes per line for the line index,
+//   plus up to twice as much for pending lines when the UI thread falls behind.
+// - Lines are identified by their absolute number since the last Clear(). The line index is a vector of (chunk, offset, length)
+//   whose front is erased when chunks are recycled, so accessing a line by number is O(1).
+// - Other threads append into pending blocks of ChunkSize bytes under a mutex, doing nothing more than a memcpy while holding it.
+//   When the UI thread doesn't call Update() for a while, the oldest block is dropped whole, so the work under the mutex
+//   stays bounded. Blocks are recycled, so appending doesn't allocate once warmed up.
+//   The UI thread swaps the list of pending blocks in Update() and parses them into lines outside the mutex.
+// Filtering:
+// - The numbers of lines passing the filter are stored in FilteredLines, which is updated incrementally: each frame only
+//   tests new lines. Lines are tested within a time budget per frame (FilterTimeBudget), displaying the results found so far.
+//   When lines are added faster than they can be tested, the results fall behind (see IsFiltering()) but frames don't get longer. When the filter text is only extended (e.g. typing more characters), only the previous results
+//   are tested again, as matches can only be a subset of them.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiLogConsole.
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+struct ImGuiLogConsole
+{
+    struct Line { int Chunk, Offset, Length; };     // Text of a line in the chunk of absolute number 'Chunk', without the '\n'
+
+    // Chunks of text (UI thread)
+    int                     ChunkSize;              // Bytes. Longer lines are truncated.
+    int                     MaxChunks;
+    ImVector<char*>         Chunks;                 // Ring of MaxChunks buffers: chunk n is at Chunks[n % MaxChunks]
+    int                     ChunksBegin;            // Absolute numbers of the live chunks [ChunksBegin, ChunksEnd)
+    int                     ChunksEnd;
+    int                     ChunkUsed;              // Bytes used in the last chunk
+
+    // Line index (UI thread)
+    ImVector<Line>          Lines;                  // Lines[LinesBegin] is line number FirstLine
+    int                     LinesBegin;
+    ImS64                   FirstLine;              // Absolute number of the oldest line still stored, the number of lines dropped so far
+
+    // Filtering (UI thread)
+    ImGuiTextFilter         Filter;
+    char                    FilterPrevBuf[256];     // Filter text the current results were computed with
+    ImVector<ImS64>         FilteredLines;          // Line numbers passing the filter, sorted. FilteredLines[FilteredBegin] is the first live one.
+    int                     FilteredBegin;
+    ImS64                   FilterScanNext;         // Lines from this number haven't been tested yet
+    ImVector<ImS64>         FilterRefineSource;     // After extending the filter text: previous results left to test, before FilterScanNext
+    int                     FilterRefineNext;
+    float                   FilterTimeBudget;       // Seconds per frame spent testing lines, default to 0.004f
+
+    // Display (UI thread)
+    bool                    AutoScroll;             // Keep scrolling to the bottom when the scrolling was at the bottom
+    int                     RowsDropped;            // Displayed rows dropped since the last Draw(), to keep the scrolling position on the same lines
+    ImGuiID                 ChildWindowId;
+
+    // Appends from any thread
+    struct PendingBlock { std::vector<char> Text; int LinesCount; };   // Up to ChunkSize bytes of lines. Texts larger than a block continue in the next one.
+    std::mutex              Mutex;
+    std::deque<PendingBlock> Pending;               // Blocks of the lines appended since the last Update(), at most MaxChunks. Protected by Mutex.
+    std::vector<PendingBlock> PendingFreeBlocks;    // Recycled blocks, with their memory. Protected by Mutex.
+    ImS64                   PendingDroppedLines;    // Lines dropped because the UI thread didn't call Update() for too long. Protected by Mutex.
+    std::deque<PendingBlock> PendingSwap;           // UI thread: blocks being parsed, recycled on the next Update()
+    ImS64                   PendingDroppedLinesCopy; // UI thread: PendingDroppedLines as of the last Update()
+    std::vector<char>       PendingCarry;           // UI thread: start of a line continued in the next block
+
+    IMGUI_API ImGuiLogConsole(int max_bytes = 64 * 1024 * 1024, int chunk_size = 256 * 1024);
+    IMGUI_API ~ImGuiLogConsole();
+
+    // Any thread
+    IMGUI_API void          AddText(const char* text, const char* text_end = NULL);    // One or more lines. A missing trailing '\n' is implied.
+    IMGUI_API void          AddLog(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void          AddLogV(const char* fmt, va_list args) IM_FMTLIST(2);
+
+    // UI thread
+    IMGUI_API void          Clear();
+    IMGUI_API void          Update();                                                   // Parse pending lines and update the filter results. Called by Draw().
+    IMGUI_API void          Draw(const char* title, bool* p_open = NULL);
+    IMGUI_API void          DrawContents();                                             // Filter bar and clipped lines, in the current window
+
+    ImS64                   GetLinesCount() const               { return Lines.Size - LinesBegin; }
+    ImS64                   GetEndLine() const                  { return FirstLine + GetLinesCount(); }
+    IMGUI_API void          GetLine(ImS64 line_no, const char** out_begin, const char** out_end) const;
+    bool                    IsFiltering() const                 { return FilterRefineNext < FilterRefineSource.Size || FilterScanNext < GetEndLine(); }
+};
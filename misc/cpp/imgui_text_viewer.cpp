@@ -0,0 +1,617 @@
+// dear imgui: read-only viewer for large text files (multi-GB logs, CSV), memory-mapped and indexed on a background thread, using C++11 <thread>
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiTextViewer.
+
+#include "imgui.h"
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+#include "imgui_text_viewer.h"
+#include <stdio.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// SSE2 for byte comparisons (IMGUI_ENABLE_SSE only guarantees SSE)
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(__x86_64__))
+#define IMGUI_TEXT_VIEWER_SSE2
+#endif
+
+// Background threads scan the file by blocks, releasing the pages of each block once scanned
+static const ImU64 SCAN_BLOCK_BYTES = 16 * 1024 * 1024;
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+// Drop the pages of a scanned range from the working set. They are read again from the file if accessed later.
+static void ReleasePages(const char* p, ImU64 size)
+{
+    const uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    const uintptr_t begin = ((uintptr_t)p + page_size - 1) & ~(page_size - 1);
+    const uintptr_t end = ((uintptr_t)p + (uintptr_t)size) & ~(page_size - 1);
+    if (end > begin)
+        madvise((void*)begin, (size_t)(end - begin), MADV_DONTNEED);
+}
+
+static inline bool IsAsciiLetter(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static bool MatchText(const char* a, const char* b, size_t len, bool case_sensitive)
+{
+    if (case_sensitive)
+        return memcmp(a, b, len) == 0;
+    for (size_t n = 0; n < len; n++)
+    {
+        unsigned char ca = (unsigned char)a[n], cb = (unsigned char)b[n];
+        if (ca == cb)
+            continue;
+        if (!IsAsciiLetter(ca) || (ca | 0x20) != (cb | 0x20))
+            return false;
+    }
+    return true;
+}
+
+const char* ImGuiTextViewerFindText(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end, bool case_sensitive)
+{
+    const size_t len = (size_t)(needle_end - needle);
+    if (len == 0)
+        return haystack;
+    if ((size_t)(haystack_end - haystack) < len)
+        return NULL;
+    const char* last_start = haystack_end - len;
+
+    // Compare (byte | fold) with the lowercase needle byte, for ASCII letters when case insensitive
+    unsigned char first = (unsigned char)needle[0], last = (unsigned char)needle[len - 1];
+    const unsigned char first_fold = (!case_sensitive && IsAsciiLetter(first)) ? 0x20 : 0x00;
+    const unsigned char last_fold = (!case_sensitive && IsAsciiLetter(last)) ? 0x20 : 0x00;
+    first |= first_fold;
+    last |= last_fold;
+
+    const char* p = haystack;
+#ifdef IMGUI_TEXT_VIEWER_SSE2
+    // Candidates are positions where both the first and the last byte match, 16 positions at a time
+    const __m128i v_first = _mm_set1_epi8((char)first), v_first_fold = _mm_set1_epi8((char)first_fold);
+    const __m128i v_last = _mm_set1_epi8((char)last), v_last_fold = _mm_set1_epi8((char)last_fold);
+    for (; last_start - p >= 15; p += 16)
+    {
+        const __m128i block_first = _mm_or_si128(_mm_loadu_si128((const __m128i*)p), v_first_fold);
+        const __m128i block_last = _mm_or_si128(_mm_loadu_si128((const __m128i*)(p + len - 1)), v_last_fold);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, v_first), _mm_cmpeq_epi8(block_last, v_last)));
+        while (mask != 0)
+        {
+            const int bit = __builtin_ctz(mask);
+            if (len <= 2 || MatchText(p + bit + 1, needle + 1, len - 2, case_sensitive))
+                return p + bit;
+            mask &= mask - 1;
+        }
+    }
+#else
+    if (first_fold == 0)
+    {
+        // Let memchr() find candidates for the first byte
+        while ((p = (const char*)memchr(p, first, (size_t)(last_start - p) + 1)) != NULL)
+        {
+            if (((unsigned char)p[len - 1] | last_fold) == last && (len <= 2 || MatchText(p + 1, needle + 1, len - 2, case_sensitive)))
+                return p;
+            p++;
+        }
+        return NULL;
+    }
+#endif
+    for (; p <= last_start; p++)
+        if (((unsigned char)p[0] | first_fold) == first && ((unsigned char)p[len - 1] | last_fold) == last)
+            if (len <= 2 || MatchText(p + 1, needle + 1, len - 2, case_sensitive))
+                return p;
+    return NULL;
+}
+
+// Read one character. A byte which doesn't start a UTF-8 sequence (ImTextCharFromUtf8() returns 0) is one invalid character.
+static inline int DecodeChar(unsigned int* out_char, const char* s, const char* s_end)
+{
+    unsigned int c = (unsigned char)*s;
+    int bytes = (c < 0x80) ? 1 : ImTextCharFromUtf8(&c, s, s_end);
+    if (bytes == 0)
+    {
+        c = IM_UNICODE_CODEPOINT_INVALID;
+        bytes = 1;
+    }
+    *out_char = c;
+    return bytes;
+}
+
+// Sum of the advances of the characters in [text, text_end), stopping before exceeding 'max_width'. Return the end of the measured text.
+static const char* CalcTextAdvance(ImFont* font, float scale, const char* text, const char* text_end, float max_width, float* out_width)
+{
+    float width = 0.0f;
+    const char* s = text;
+    while (s < text_end)
+    {
+        unsigned int c;
+        const int bytes = DecodeChar(&c, s, text_end);
+        const float advance = font->GetCharAdvance((ImWchar)c) * scale;
+        if (width + advance > max_width)
+            break;
+        width += advance;
+        s += bytes;
+    }
+    *out_width = width;
+    return s;
+}
+
+// ImFont::RenderText() stops at the first byte which doesn't start a UTF-8 sequence: draw the runs in between,
+// and an invalid character for each of those bytes, as measured by CalcTextAdvance().
+static void RenderLineText(ImDrawList* draw_list, ImFont* font, float font_size, ImVec2 pos, ImU32 col, const char* text, const char* text_end)
+{
+    const float scale = font_size / font->FontSize;
+    const char* run_begin = text;
+    float run_x = pos.x;
+    for (const char* s = text; s < text_end; )
+    {
+        unsigned int c = (unsigned char)*s;
+        const int bytes = (c < 0x80) ? 1 : ImTextCharFromUtf8(&c, s, text_end);
+        if (bytes != 0)
+        {
+            s += bytes;
+            continue;
+        }
+        float run_width;
+        CalcTextAdvance(font, scale, run_begin, s, FLT_MAX, &run_width);
+        draw_list->AddText(font, font_size, ImVec2(run_x, pos.y), col, run_begin, s);
+        run_x += run_width;
+        font->RenderChar(draw_list, font_size, ImVec2(run_x, pos.y), col, (ImWchar)IM_UNICODE_CODEPOINT_INVALID);
+        run_x += font->GetCharAdvance((ImWchar)IM_UNICODE_CODEPOINT_INVALID) * scale;
+        run_begin = ++s;
+    }
+    draw_list->AddText(font, font_size, ImVec2(run_x, pos.y), col, run_begin, text_end);
+}
+
+//-----------------------------------------------------------------------------
+// Background threads
+//-----------------------------------------------------------------------------
+
+static void AddCheckpoint(ImGuiTextViewer* viewer, int checkpoint_n, ImU64 offset)
+{
+    ImU64*& block = viewer->CheckpointBlocks[checkpoint_n / ImGuiTextViewer::CheckpointsPerBlock];
+    if (block == NULL)
+        block = new ImU64[ImGuiTextViewer::CheckpointsPerBlock];
+    block[checkpoint_n % ImGuiTextViewer::CheckpointsPerBlock] = offset;
+}
+
+static void IndexThreadMain(ImGuiTextViewer* viewer)
+{
+    const char* data = viewer->Data;
+    const ImU64 data_size = viewer->DataSize;
+    ImS64 lines_count = 0;
+    ImU64 line_start = 0, max_line_bytes = 0;
+    int checkpoints_count = 0;
+    AddCheckpoint(viewer, checkpoints_count++, 0);
+    for (ImU64 block_begin = 0; block_begin < data_size && !viewer->Cancel.load(std::memory_order_relaxed); block_begin += SCAN_BLOCK_BYTES)
+    {
+        const ImU64 block_end = ImMin(block_begin + SCAN_BLOCK_BYTES, data_size);
+        const char* p = data + block_begin;
+        const char* p_end = data + block_end;
+        while ((p = (const char*)memchr(p, '\n', (size_t)(p_end - p))) != NULL)
+        {
+            const ImU64 line_end = (ImU64)(p - data);
+            max_line_bytes = ImMax(max_line_bytes, line_end - line_start);
+            line_start = line_end + 1;
+            if (++lines_count % ImGuiTextViewer::LinesPerCheckpoint == 0)
+                AddCheckpoint(viewer, checkpoints_count++, line_start);
+            p++;
+        }
+        viewer->CheckpointsCount.store(checkpoints_count, std::memory_order_release);
+        viewer->MaxLineBytes.store(max_line_bytes, std::memory_order_relaxed);
+        viewer->IndexedBytes.store(block_end, std::memory_order_release);
+        viewer->IndexedLinesCount.store(lines_count, std::memory_order_release);
+        ReleasePages(data + block_begin, block_end - block_begin);
+    }
+    if (viewer->Cancel.load(std::memory_order_relaxed))
+        return;
+
+    // Last line without a trailing newline
+    if (line_start < data_size)
+    {
+        viewer->MaxLineBytes.store(ImMax(max_line_bytes, data_size - line_start), std::memory_order_relaxed);
+        viewer->IndexedLinesCount.store(lines_count + 1, std::memory_order_release);
+    }
+    viewer->IndexDone.store(true, std::memory_order_release);
+}
+
+static void SearchRange(ImGuiTextViewer* viewer, const char* needle, size_t needle_len, bool case_sensitive, ImU64 begin, ImU64 end)
+{
+    const char* data = viewer->Data;
+    for (ImU64 block_begin = begin; block_begin < end; block_begin += SCAN_BLOCK_BYTES)
+    {
+        if (viewer->Cancel.load(std::memory_order_relaxed) || viewer->SearchResult.load(std::memory_order_relaxed) != -2)
+            return;
+        // Blocks overlap by needle_len - 1 bytes, so matches across block boundaries are found
+        const ImU64 block_end = ImMin(block_begin + SCAN_BLOCK_BYTES, end);
+        const ImU64 search_end = ImMin(block_end + needle_len - 1, viewer->DataSize);
+        if (const char* match = ImGuiTextViewerFindText(data + block_begin, data + search_end, needle, needle + needle_len, case_sensitive))
+            viewer->SearchResult.store((ImS64)(match - data), std::memory_order_release);
+        ReleasePages(data + block_begin, block_end - block_begin);
+        viewer->SearchScannedBytes.fetch_add(block_end - block_begin, std::memory_order_relaxed);
+    }
+}
+
+static void SearchThreadMain(ImGuiTextViewer* viewer, std::vector<char> needle, bool case_sensitive, ImU64 start)
+{
+    SearchRange(viewer, needle.data(), needle.size(), case_sensitive, start, viewer->DataSize);
+    SearchRange(viewer, needle.data(), needle.size(), case_sensitive, 0, start);
+    ImS64 in_progress = -2;
+    viewer->SearchResult.compare_exchange_strong(in_progress, -1);
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiTextViewer
+//-----------------------------------------------------------------------------
+
+ImGuiTextViewer::ImGuiTextViewer()
+{
+    Data = NULL;
+    DataSize = 0;
+    FileDescriptor = -1;
+    CheckpointsCount = 0;
+    IndexedLinesCount = 0;
+    IndexedBytes = 0;
+    MaxLineBytes = 0;
+    IndexDone = false;
+    SearchBuf[0] = 0;
+    SearchCaseSensitive = false;
+    SearchResult = -1;
+    SearchScannedBytes = 0;
+    SearchStart = SearchMatchOffset = 0;
+    SearchMatchLength = 0;
+    SearchMatchPending = SearchFailed = false;
+    Cancel = false;
+    MaxLineDisplayBytes = 16 * 1024;
+    ScrollLine = 0;
+    ScrollToLine = -1;
+    VisibleLinesBegin = VisibleLinesEnd = 0;
+}
+
+ImGuiTextViewer::~ImGuiTextViewer()
+{
+    Close();
+}
+
+bool ImGuiTextViewer::Open(const char* filename)
+{
+    Close();
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (ImU64)st.st_size > (ImU64)(size_t)-1)
+    {
+        close(fd);
+        return false;
+    }
+    const void* data = NULL;
+    if (st.st_size > 0)
+    {
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+    }
+    FileDescriptor = fd;
+    DataSize = (ImU64)st.st_size;
+    Data = (const char*)data;
+
+    // Worst case: one line per byte, one checkpoint every LinesPerCheckpoint lines, plus checkpoint 0
+    const ImU64 max_checkpoints = DataSize / LinesPerCheckpoint + 2;
+    CheckpointBlocks.assign((size_t)((max_checkpoints + CheckpointsPerBlock - 1) / CheckpointsPerBlock), NULL);
+    IndexThread = std::thread(IndexThreadMain, this);
+    return true;
+}
+
+void ImGuiTextViewer::Close()
+{
+    Cancel = true;
+    if (IndexThread.joinable())
+        IndexThread.join();
+    CancelSearch();
+    Cancel = false;
+    if (FileDescriptor == -1)
+        return;
+
+    if (Data)
+        munmap((void*)Data, (size_t)DataSize);
+    close(FileDescriptor);
+    Data = NULL;
+    DataSize = 0;
+    FileDescriptor = -1;
+    for (size_t n = 0; n < CheckpointBlocks.size(); n++)
+        delete[] CheckpointBlocks[n];
+    CheckpointBlocks.clear();
+    CheckpointsCount = 0;
+    IndexedLinesCount = 0;
+    IndexedBytes = 0;
+    MaxLineBytes = 0;
+    IndexDone = false;
+    SearchResult = -1;
+    SearchMatchLength = 0;
+    SearchMatchPending = SearchFailed = false;
+    ScrollLine = 0;
+    ScrollToLine = -1;
+    VisibleLinesBegin = VisibleLinesEnd = 0;
+}
+
+ImS64 ImGuiTextViewer::GetLinesCount() const
+{
+    return IndexedLinesCount.load(std::memory_order_acquire);
+}
+
+static const char* GetCheckpoint(const ImGuiTextViewer* viewer, int checkpoint_n)
+{
+    return viewer->Data + viewer->CheckpointBlocks[checkpoint_n / ImGuiTextViewer::CheckpointsPerBlock][checkpoint_n % ImGuiTextViewer::CheckpointsPerBlock];
+}
+
+// Return the end of the line starting at 'line_begin', before its "\n" or "\r\n"
+static const char* FindLineEnd(const ImGuiTextViewer* viewer, const char* line_begin, const char** out_next_line)
+{
+    const char* data_end = viewer->Data + viewer->DataSize;
+    const char* line_end = (const char*)memchr(line_begin, '\n', (size_t)(data_end - line_begin));
+    if (line_end == NULL)
+        line_end = data_end;
+    *out_next_line = (line_end < data_end) ? line_end + 1 : data_end;
+    if (line_end > line_begin && line_end[-1] == '\r')
+        line_end--;
+    return line_end;
+}
+
+bool ImGuiTextViewer::GetLine(ImS64 line_n, const char** out_begin, const char** out_end) const
+{
+    if (line_n < 0 || line_n >= GetLinesCount())
+        return false;
+    const char* p = GetCheckpoint(this, (int)(line_n / LinesPerCheckpoint));
+    const char* data_end = Data + DataSize;
+    for (int n = (int)(line_n % LinesPerCheckpoint); n > 0; n--)
+        p = (const char*)memchr(p, '\n', (size_t)(data_end - p)) + 1;
+    const char* next_line;
+    *out_begin = p;
+    *out_end = FindLineEnd(this, p, &next_line);
+    return true;
+}
+
+ImS64 ImGuiTextViewer::FindLineAtOffset(ImU64 offset) const
+{
+    if (offset >= IndexedBytes.load(std::memory_order_acquire) || Data == NULL)
+        return -1;
+
+    // Last checkpoint at or before 'offset', then count the lines in between
+    int lo = 0, hi = CheckpointsCount.load(std::memory_order_acquire);
+    while (hi - lo > 1)
+    {
+        const int mid = lo + (hi - lo) / 2;
+        if ((ImU64)(GetCheckpoint(this, mid) - Data) <= offset)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    ImS64 line_n = (ImS64)lo * LinesPerCheckpoint;
+    const char* target = Data + offset;
+    for (const char* p = GetCheckpoint(this, lo); (p = (const char*)memchr(p, '\n', (size_t)(target - p))) != NULL; p++)
+        line_n++;
+    return line_n;
+}
+
+void ImGuiTextViewer::Search(const char* text, bool case_sensitive, ImU64 offset)
+{
+    CancelSearch();
+    const size_t len = strlen(text);
+    if (len == 0 || Data == NULL)
+        return;
+    if (text != SearchBuf)
+        ImStrncpy(SearchBuf, text, IM_ARRAYSIZE(SearchBuf)); // Displayed in the search bar, and its length is the length of the match
+    SearchStart = ImMin(offset, DataSize);
+    SearchFailed = false;
+    SearchResult = -2;
+    SearchScannedBytes = 0;
+    SearchThread = std::thread(SearchThreadMain, this, std::vector<char>(text, text + len), case_sensitive, SearchStart);
+}
+
+void ImGuiTextViewer::CancelSearch()
+{
+    if (!SearchThread.joinable())
+        return;
+    ImS64 in_progress = -2;
+    SearchResult.compare_exchange_strong(in_progress, -1);
+    SearchThread.join();
+}
+
+void ImGuiTextViewer::Draw(const char* title, bool* p_open)
+{
+    if (!ImGui::Begin(title, p_open))
+    {
+        ImGui::End();
+        return;
+    }
+    DrawContents();
+    ImGui::End();
+}
+
+void ImGuiTextViewer::DrawContents()
+{
+    ImGuiContext& g = *GImGui;
+
+    // Search bar
+    bool search = ImGui::InputTextWithHint("##search", "Search", SearchBuf, IM_ARRAYSIZE(SearchBuf), ImGuiInputTextFlags_EnterReturnsTrue);
+    ImGui::SameLine();
+    search |= ImGui::Button("Find next");
+    ImGui::SameLine();
+    ImGui::Checkbox("Match case", &SearchCaseSensitive);
+    if (search && SearchBuf[0] != 0)
+    {
+        // Continue after the last match if it is still displayed, otherwise start from the top of the view
+        const char* first_line_begin;
+        const char* first_line_end;
+        const ImS64 match_line_n = (SearchMatchLength > 0) ? FindLineAtOffset(SearchMatchOffset) : -1;
+        ImU64 offset = 0;
+        if (match_line_n >= VisibleLinesBegin && match_line_n < VisibleLinesEnd)
+            offset = SearchMatchOffset + 1;
+        else if (GetLine(VisibleLinesBegin, &first_line_begin, &first_line_end))
+            offset = (ImU64)(first_line_begin - Data);
+        Search(SearchBuf, SearchCaseSensitive, offset);
+    }
+    const ImS64 search_result = SearchResult.load(std::memory_order_acquire);
+    if (SearchThread.joinable() && search_result != -2)
+    {
+        SearchThread.join();
+        SearchMatchLength = (search_result >= 0) ? (int)strlen(SearchBuf) : 0;
+        SearchMatchOffset = (search_result >= 0) ? (ImU64)search_result : 0;
+        SearchMatchPending = (search_result >= 0);
+        SearchFailed = (search_result < 0);
+    }
+    if (SearchMatchPending)
+    {
+        const ImS64 line_n = FindLineAtOffset(SearchMatchOffset);
+        if (line_n >= 0 && line_n < GetLinesCount())
+        {
+            ScrollToLine = line_n;
+            SearchMatchPending = false;
+        }
+    }
+
+    // Status
+    const ImS64 lines_count = GetLinesCount();
+    ImGui::Text("%lld lines, %.1f MB", (long long)lines_count, DataSize / (1024.0 * 1024.0));
+    if (IsIndexing())
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("Indexing... %d%%", DataSize ? (int)(IndexedBytes.load(std::memory_order_relaxed) * 100 / DataSize) : 0);
+    }
+    if (SearchThread.joinable())
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("Searching... %d%%", DataSize ? (int)(SearchScannedBytes.load(std::memory_order_relaxed) * 100 / DataSize) : 0);
+    }
+    else if (SearchMatchPending || SearchFailed)
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled(SearchMatchPending ? "Found, waiting for the index..." : "Not found");
+    }
+    ImGui::Separator();
+
+    // Lines
+    ImFont* font = ImGui::GetFont();
+    const float font_scale = g.FontSize / font->FontSize;
+    const float line_height = ImGui::GetTextLineHeight();
+    const float digit_width = font->GetCharAdvance('0') * font_scale;
+    int digits_count = 1;
+    for (ImS64 n = lines_count; n >= 10; n /= 10)
+        digits_count++;
+    const float gutter_width = digit_width * (digits_count + 1);
+    const float scrollbar_width = g.Style.ScrollbarSize;
+    const float content_width = gutter_width + digit_width * (float)ImMin(MaxLineBytes.load(std::memory_order_relaxed), (ImU64)MaxLineDisplayBytes) + scrollbar_width;
+    ImGui::SetNextWindowContentSize(ImVec2(content_width, 1.0f)); // The window only scrolls horizontally
+    ImGui::BeginChild("##lines", ImVec2(0.0f, 0.0f), false, ImGuiWindowFlags_HorizontalScrollbar);
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    const ImRect clip_rect = window->InnerClipRect;
+    const float text_clip_min_x = clip_rect.Min.x + gutter_width;
+    const float text_clip_max_x = clip_rect.Max.x - scrollbar_width;
+    const ImS64 page_lines = ImMax((ImS64)(window->InnerRect.GetHeight() / line_height), (ImS64)1);
+
+    // Vertical scrolling, in lines
+    const char* match_begin = (SearchMatchLength > 0) ? Data + SearchMatchOffset : NULL;
+    if (ScrollToLine >= 0)
+    {
+        // Center the match vertically, and horizontally if it isn't visible
+        ScrollLine = ScrollToLine - page_lines / 2;
+        const char* line_begin;
+        const char* line_end;
+        if (match_begin != NULL && GetLine(ScrollToLine, &line_begin, &line_end) && match_begin >= line_begin && match_begin <= line_end)
+        {
+            float match_x;
+            CalcTextAdvance(font, font_scale, line_begin, match_begin, FLT_MAX, &match_x);
+            const float visible_width = text_clip_max_x - text_clip_min_x;
+            if (match_x < window->Scroll.x || match_x > window->Scroll.x + visible_width - digit_width * SearchMatchLength)
+                ImGui::SetScrollX(ImMax(match_x - visible_width * 0.5f, 0.0f));
+        }
+        ScrollToLine = -1;
+    }
+    if (g.IO.MouseWheel != 0.0f && !g.IO.KeyShift && !g.IO.KeyCtrl && g.WheelingWindow == window)
+    {
+        // Same step as window scrolling: 5 lines, at most 2/3 of the view. Round away from zero so small steps still scroll.
+        const float wheel_lines = g.IO.MouseWheel * ImMin(5.0f, ImMax(ImFloor(page_lines * 0.67f), 1.0f));
+        ScrollLine -= (ImS64)((wheel_lines > 0.0f) ? ImCeil(wheel_lines) : ImFloor(wheel_lines));
+    }
+    const ImS64 scroll_line_max = ImMax(lines_count - page_lines, (ImS64)0);
+    ScrollLine = ImClamp(ScrollLine, (ImS64)0, scroll_line_max);
+    if (scroll_line_max > 0)
+    {
+        // ScrollbarEx() works on floats: scale the lines down so they stay exact floats. Dragging only needs pixel precision.
+        const double scrollbar_scale = ImMin(1.0, (double)(1 << 20) / (double)lines_count);
+        const ImRect scrollbar_bb(clip_rect.Max.x - scrollbar_width, window->InnerRect.Min.y, clip_rect.Max.x, window->InnerRect.Max.y);
+        const ImGuiID scrollbar_id = window->GetID("##scrollbar");
+        float scroll_v = (float)(ScrollLine * scrollbar_scale);
+        ImGui::KeepAliveID(scrollbar_id);
+        if (ImGui::ScrollbarEx(scrollbar_bb, scrollbar_id, ImGuiAxis_Y, &scroll_v, (float)(page_lines * scrollbar_scale), (float)(lines_count * scrollbar_scale), ImDrawCornerFlags_None))
+            ScrollLine = ImClamp((ImS64)(scroll_v / scrollbar_scale + 0.5), (ImS64)0, scroll_line_max);
+    }
+
+    // Draw the lines fitting in the window, the last one possibly cut
+    ImDrawList* draw_list = window->DrawList;
+    const ImU32 col_text = ImGui::GetColorU32(ImGuiCol_Text);
+    const ImU32 col_line_number = ImGui::GetColorU32(ImGuiCol_TextDisabled);
+    const ImU32 col_match = ImGui::GetColorU32(ImGuiCol_TextSelectedBg);
+    const ImS64 lines_end = ImMin(ScrollLine + page_lines + 1, lines_count);
+    const char* line_begin;
+    const char* line_end;
+    VisibleLinesBegin = ScrollLine;
+    VisibleLinesEnd = GetLine(ScrollLine, &line_begin, &line_end) ? lines_end : ScrollLine;
+    const ImVec2 lines_pos = window->DC.CursorPos;
+    draw_list->PushClipRect(ImVec2(text_clip_min_x, clip_rect.Min.y), ImVec2(text_clip_max_x, clip_rect.Max.y), true);
+    for (ImS64 line_n = VisibleLinesBegin; line_n < VisibleLinesEnd; line_n++)
+    {
+        const char* next_line;
+        line_end = FindLineEnd(this, line_begin, &next_line);
+        const char* display_end = (line_end - line_begin > MaxLineDisplayBytes) ? line_begin + MaxLineDisplayBytes : line_end;
+        const ImVec2 pos(lines_pos.x, lines_pos.y + (float)(line_n - VisibleLinesBegin) * line_height);
+        const float text_x = pos.x + gutter_width;
+
+        // Highlight the search match
+        if (match_begin != NULL && match_begin >= line_begin && match_begin < display_end)
+        {
+            float match_x0, match_x1;
+            CalcTextAdvance(font, font_scale, line_begin, match_begin, FLT_MAX, &match_x0);
+            CalcTextAdvance(font, font_scale, match_begin, ImMin(match_begin + SearchMatchLength, display_end), FLT_MAX, &match_x1);
+            draw_list->AddRectFilled(ImVec2(text_x + match_x0, pos.y), ImVec2(text_x + match_x0 + match_x1, pos.y + line_height), col_match);
+        }
+
+        // Skip characters left of the visible area (the first one drawn may cross the left edge), and stop at the right edge
+        float skip_width, visible_width;
+        const char* visible_begin = CalcTextAdvance(font, font_scale, line_begin, display_end, text_clip_min_x - text_x, &skip_width);
+        const char* visible_end = CalcTextAdvance(font, font_scale, visible_begin, display_end, text_clip_max_x - (text_x + skip_width), &visible_width);
+        if (visible_end < display_end)
+        {
+            unsigned int c;
+            visible_end += DecodeChar(&c, visible_end, display_end); // Character crossing the right edge
+        }
+        RenderLineText(draw_list, font, g.FontSize, ImVec2(text_x + skip_width, pos.y), col_text, visible_begin, visible_end);
+        line_begin = next_line;
+    }
+    draw_list->PopClipRect();
+
+    // Line numbers, not scrolled horizontally
+    for (ImS64 line_n = VisibleLinesBegin; line_n < VisibleLinesEnd; line_n++)
+    {
+        char line_number[24];
+        const int line_number_len = ImFormatString(line_number, IM_ARRAYSIZE(line_number), "%lld", (long long)(line_n + 1));
+        const float y = lines_pos.y + (float)(line_n - VisibleLinesBegin) * line_height;
+        draw_list->AddText(ImVec2(clip_rect.Min.x + gutter_width - digit_width * (line_number_len + 1), y), col_line_number, line_number, line_number + line_number_len);
+    }
+    ImGui::ItemSize(ImVec2(0.0f, (float)(VisibleLinesEnd - VisibleLinesBegin) * line_height));
+    ImGui::EndChild();
+}
@@ -0,0 +1,103 @@
+// dear imgui: read-only viewer for large text files (multi-GB logs, CSV), memory-mapped and indexed on a background thread, using C++11 <thread>
+// POSIX only (mmap, madvise): there is no Windows implementation.
+
+// Usage:
+//   static ImGuiTextViewer viewer;
+//   if (!viewer.IsOpen())
+//       viewer.Open("server.log");     // Map the file and start indexing lines on a background thread
+//   viewer.Draw("server.log");         // Begin() + search bar + clipped lines + End(). Lines appear as they are indexed.
+//   [...]
+//   viewer.Close();                    // Stop background threads and unmap the file
+
+// Memory:
+// - The file is memory-mapped and never copied: the pages of the displayed lines are read by the OS on demand.
+//   The indexing and search threads read the whole file, but release the pages behind them, so resident memory stays
+//   proportional to the visible lines. A 64-bit build is required for files larger than the address space.
+// - The line index is sparse: the offset of one line out of LinesPerCheckpoint (256) is stored, 8 bytes per 256 lines.
+//   Finding a line scans at most 255 lines from its checkpoint with memchr(), which is done once per frame for the first
+//   visible line, the next visible lines following it.
+// Display:
+// - Vertical scrolling is done in lines (ScrollLine) with our own scrollbar: a float scroll position in pixels can't address
+//   every line past ~16M lines. The child window only scrolls horizontally, and only the lines fitting in it are drawn.
+// - Each line is clipped on the CPU before rendering: characters left of the horizontal scrolling are skipped by summing
+//   their advance, and drawing stops at the right edge. Bytes which don't start a UTF-8 sequence are drawn as U+FFFD.
+//   Lines longer than MaxLineDisplayBytes are truncated when displayed. The content width is estimated from the length
+//   of the longest line found by the indexer.
+// Search:
+// - Runs on a background thread from the current position, wrapping around, and scrolls to the match once the indexer
+//   reached it. Uses SSE2 when available: candidates are the positions where both the first and the last byte of the
+//   text match, 16 positions at a time, verified with memcmp(). Case insensitive search only folds ASCII letters.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiTextViewer.
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+struct ImGuiTextViewer
+{
+    enum { LinesPerCheckpoint = 256, CheckpointsPerBlock = 64 * 1024 };
+
+    // File (read-only after Open())
+    const char*                 Data;
+    ImU64                       DataSize;
+    int                         FileDescriptor;         // -1 when closed
+
+    // Sparse line index, written by the indexing thread. Checkpoint n is the offset of line n * LinesPerCheckpoint.
+    // Blocks have a fixed address once allocated, and are published by CheckpointsCount (release/acquire).
+    std::vector<ImU64*>         CheckpointBlocks;       // Sized by Open() for the worst case, allocated by the indexing thread
+    std::atomic<int>            CheckpointsCount;
+    std::atomic<ImS64>          IndexedLinesCount;      // Lines known to end at or before IndexedBytes (published after checkpoints)
+    std::atomic<ImU64>          IndexedBytes;
+    std::atomic<ImU64>          MaxLineBytes;
+    std::atomic<bool>           IndexDone;
+    std::thread                 IndexThread;
+
+    // Search
+    char                        SearchBuf[256];
+    bool                        SearchCaseSensitive;
+    std::thread                 SearchThread;
+    std::atomic<ImS64>          SearchResult;           // Offset of the match, -1: not found, -2: in progress
+    std::atomic<ImU64>          SearchScannedBytes;     // Progress
+    ImU64                       SearchStart;            // Offset where the search started
+    ImU64                       SearchMatchOffset;      // Last match found, highlighted
+    int                         SearchMatchLength;
+    bool                        SearchMatchPending;     // Found but not indexed yet: scroll to it when it is
+    bool                        SearchFailed;
+
+    std::atomic<bool>           Cancel;                 // Stop background threads
+
+    // Display
+    int                         MaxLineDisplayBytes;    // Default to 16 KB
+    ImS64                       ScrollLine;             // First line displayed
+    ImS64                       ScrollToLine;           // -1: none. Centered on the next frame.
+    ImS64                       VisibleLinesBegin;      // Lines displayed during the last frame
+    ImS64                       VisibleLinesEnd;
+
+    ImGuiTextViewer();
+    ~ImGuiTextViewer();
+
+    // Open/close a file. Open() returns false if the file can't be opened or mapped.
+    IMGUI_API bool          Open(const char* filename);
+    IMGUI_API void          Close();
+    bool                    IsOpen() const                  { return FileDescriptor != -1; }
+
+    // Lines
+    ImS64                   GetLinesCount() const;          // Lines indexed so far, all lines once IsIndexing() returns false
+    bool                    IsIndexing() const              { return !IndexDone.load(std::memory_order_acquire); }
+    IMGUI_API bool          GetLine(ImS64 line_n, const char** out_begin, const char** out_end) const;  // Without the "\n" or "\r\n"
+    IMGUI_API ImS64         FindLineAtOffset(ImU64 offset) const;                                       // -1 if not indexed yet
+
+    // Search from 'offset' on a background thread, wrapping around. Poll SearchResult, or let Draw() handle it. 'text' is copied to SearchBuf.
+    IMGUI_API void          Search(const char* text, bool case_sensitive, ImU64 offset);
+    IMGUI_API void          CancelSearch();
+
+    IMGUI_API void          Draw(const char* title, bool* p_open = NULL);
+    IMGUI_API void          DrawContents();                 // Search bar and clipped lines, in the current window
+};
+
+// Search 'needle' in [haystack, haystack_end). Return NULL if not found. Exposed for the search thread and tests.
+IMGUI_API const char*   ImGuiTextViewerFindText(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end, bool case_sensitive);
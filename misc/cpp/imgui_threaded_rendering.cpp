@@ -0,0 +1,180 @@
+// dear imgui: helpers to render on a separate thread and to draw from other threads, using C++11 <atomic>
+// This is also an example of how you may hand over ImDrawDataSnapshot to your own job system.
+
+// Changelog:
+// - v0.10: Initial version. Added ImDrawDataTripleBuffer.
+// - v0.11: Added ImDrawListProducer.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include "imgui_threaded_rendering.h"
+
+enum { ExchangeFlag_New = 1 << 2, ExchangeFlag_IndexMask = 3 };
+
+ImDrawDataTripleBuffer::ImDrawDataTripleBuffer()
+{
+    _WriteIdx = 0;
+    _ExchangeIdx = 1;
+    _ReadIdx = 2;
+    _PublishCount = 0;
+    _AcquireCount = 0;
+}
+
+void ImDrawDataTripleBuffer::Publish(ImDrawData* draw_data)
+{
+    // Fill the buffer we own, then exchange it with the third buffer (which the render thread doesn't own).
+    // Release ordering makes the snapshot contents visible to the thread which will acquire this index.
+    _Snapshots[_WriteIdx].SwapFrom(draw_data);
+    _WriteIdx = _ExchangeIdx.exchange(_WriteIdx | ExchangeFlag_New, std::memory_order_acq_rel) & ExchangeFlag_IndexMask;
+    _PublishCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+ImDrawData* ImDrawDataTripleBuffer::Acquire(bool* out_is_new)
+{
+    bool is_new = false;
+    if (_ExchangeIdx.load(std::memory_order_relaxed) & ExchangeFlag_New)
+    {
+        _ReadIdx = _ExchangeIdx.exchange(_ReadIdx, std::memory_order_acq_rel) & ExchangeFlag_IndexMask;
+        _AcquireCount.fetch_add(1, std::memory_order_relaxed);
+        is_new = true;
+    }
+    if (out_is_new)
+        *out_is_new = is_new;
+    ImDrawData* draw_data = &_Snapshots[_ReadIdx].DrawData;
+    return draw_data->Valid ? draw_data : NULL;
+}
+
+void ImDrawDataTripleBuffer::Clear()
+{
+    for (int n = 0; n < 3; n++)
+        _Snapshots[n].Clear();
+}
+
+//-----------------------------------------------------------------------------
+// ImDrawListProducer
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+
+ImDrawListProducer::ImDrawListProducer()
+{
+    _Data = NULL;
+    for (int n = 0; n < 3; n++)
+        _Lists[n] = NULL;
+    _WriteIdx = 0;
+    _ExchangeIdx = 1;
+    _ReadIdx = 2;
+    _ReadValid = false;
+    _PublishCount = 0;
+    _AcquireCount = 0;
+}
+
+void ImDrawListProducer::Init()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.WithinFrameScope && "Call Init() between NewFrame() and Render(), so the font and tessellation settings are set.");
+    IM_ASSERT(_Data == NULL && "Already initialized!");
+    _Data = IM_NEW(ImDrawListSharedData)(g.DrawListSharedData);
+    _Data->ClipRectFullscreen = ImVec4(-8192.0f, -8192.0f, 8192.0f, 8192.0f); // Local coordinates, clipped by AddToDrawList()
+    for (int n = 0; n < 3; n++)
+    {
+        _Lists[n] = IM_NEW(ImDrawList)(_Data);
+        _Lists[n]->_OwnerName = "##Producer";
+    }
+    _WriteIdx = 0;
+    _ExchangeIdx = 1;
+    _ReadIdx = 2;
+    _ReadValid = false;
+}
+
+void ImDrawListProducer::Shutdown()
+{
+    if (_Data == NULL)
+        return;
+    for (int n = 0; n < 3; n++)
+    {
+        IM_DELETE(_Lists[n]);
+        _Lists[n] = NULL;
+    }
+    IM_DELETE(_Data);
+    _Data = NULL;
+}
+
+ImDrawList* ImDrawListProducer::Begin()
+{
+    IM_ASSERT(_Data != NULL && "Forgot to call Init()?");
+    ImDrawList* draw_list = _Lists[_WriteIdx];
+    draw_list->_ResetForNewFrame();
+    draw_list->PushTextureID(_Data->Font->ContainerAtlas->TexID);
+    draw_list->PushClipRectFullScreen();
+    return draw_list;
+}
+
+void ImDrawListProducer::End()
+{
+    // Same exchange as ImDrawDataTripleBuffer::Publish()
+    _Lists[_WriteIdx]->_PopUnusedDrawCmd();
+    _WriteIdx = _ExchangeIdx.exchange(_WriteIdx | ExchangeFlag_New, std::memory_order_acq_rel) & ExchangeFlag_IndexMask;
+    _PublishCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ImDrawListProducer::AddToDrawList(ImDrawList* draw_list, const ImVec2& offset)
+{
+    IM_ASSERT(_Data != NULL && "Forgot to call Init()?");
+    if (_ExchangeIdx.load(std::memory_order_relaxed) & ExchangeFlag_New)
+    {
+        _ReadIdx = _ExchangeIdx.exchange(_ReadIdx, std::memory_order_acq_rel) & ExchangeFlag_IndexMask;
+        _AcquireCount.fetch_add(1, std::memory_order_relaxed);
+        _ReadValid = true;
+    }
+    if (!_ReadValid)
+        return;
+
+    // Copy vertices and indices one command at a time: each command is clipped by the current clip rectangle of the destination,
+    // and only copies the range of vertices it refers to, which PrimReserve() may move to a new VtxOffset on large meshes.
+    const ImDrawList* src = _Lists[_ReadIdx];
+    const ImVec4 dst_clip_rect = draw_list->_CmdHeader.ClipRect;
+    for (int cmd_n = 0; cmd_n < src->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* cmd = &src->CmdBuffer.Data[cmd_n];
+        IM_ASSERT(cmd->UserCallback == NULL && "Callbacks are not supported by ImDrawListProducer.");
+        if (cmd->ElemCount == 0 || cmd->UserCallback != NULL)
+            continue;
+        ImVec4 clip_rect(ImMax(cmd->ClipRect.x + offset.x, dst_clip_rect.x), ImMax(cmd->ClipRect.y + offset.y, dst_clip_rect.y), ImMin(cmd->ClipRect.z + offset.x, dst_clip_rect.z), ImMin(cmd->ClipRect.w + offset.y, dst_clip_rect.w));
+        if (clip_rect.x >= clip_rect.z || clip_rect.y >= clip_rect.w)
+            continue;
+
+        const ImDrawIdx* src_idx = src->IdxBuffer.Data + cmd->IdxOffset;
+        unsigned int vtx_min = src_idx[0], vtx_max = src_idx[0];
+        for (unsigned int idx_n = 1; idx_n < cmd->ElemCount; idx_n++)
+        {
+            vtx_min = ImMin(vtx_min, (unsigned int)src_idx[idx_n]);
+            vtx_max = ImMax(vtx_max, (unsigned int)src_idx[idx_n]);
+        }
+        const int vtx_count = (int)(vtx_max - vtx_min + 1);
+        const int idx_count = (int)cmd->ElemCount;
+
+        draw_list->PushClipRect(ImVec2(clip_rect.x, clip_rect.y), ImVec2(clip_rect.z, clip_rect.w));
+        draw_list->PushTextureID(cmd->TextureId);
+        draw_list->PrimReserve(idx_count, vtx_count);
+        const ImDrawVert* src_vtx = src->VtxBuffer.Data + cmd->VtxOffset + vtx_min;
+        ImDrawVert* dst_vtx = draw_list->_VtxWritePtr;
+        for (int vtx_n = 0; vtx_n < vtx_count; vtx_n++)
+        {
+            dst_vtx[vtx_n] = src_vtx[vtx_n];
+            dst_vtx[vtx_n].pos.x += offset.x;
+            dst_vtx[vtx_n].pos.y += offset.y;
+        }
+        ImDrawIdx* dst_idx = draw_list->_IdxWritePtr;
+        const unsigned int idx_base = draw_list->_VtxCurrentIdx - vtx_min;
+        for (int idx_n = 0; idx_n < idx_count; idx_n++)
+            dst_idx[idx_n] = (ImDrawIdx)(idx_base + src_idx[idx_n]);
+        draw_list->_VtxWritePtr += vtx_count;
+        draw_list->_IdxWritePtr += idx_count;
+        draw_list->_VtxCurrentIdx += vtx_count;
+        draw_list->PopTextureID();
+        draw_list->PopClipRect();
+    }
+}
+
+#endif // #ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
@@ -0,0 +1,88 @@
+// dear imgui: helpers to render on a separate thread and to draw from other threads, using C++11 <atomic>
+// This is also an example of how you may hand over ImDrawDataSnapshot to your own job system.
+
+// ImDrawDataTripleBuffer usage:
+//   static ImDrawDataTripleBuffer draw_data_buffer;
+//   UI thread:      ImGui::NewFrame(); [...] ImGui::Render(); draw_data_buffer.Publish(ImGui::GetDrawData());
+//   Render thread:  if (ImDrawData* draw_data = draw_data_buffer.Acquire()) MyRenderFunction(draw_data);
+// Neither side ever waits for the other: Publish() always has a free buffer to write into, Acquire() returns the most recently
+// published frame (frames published while the render thread was busy are skipped, and the same frame is returned again if
+// nothing new was published). This is a single producer, single consumer structure: one UI thread, one render thread.
+// The font atlas texture and any texture referred to by ImTextureID must stay valid while the render thread uses them.
+
+// ImDrawListProducer usage:
+//   static ImDrawListProducer producer;
+//   UI thread:        producer.Init();                          // Once, between NewFrame() and Render(), before the producer thread starts.
+//   Producer thread:  ImDrawList* draw_list = producer.Begin();  // Draw with any ImDrawList function, in local coordinates.
+//                     draw_list->AddPolyline(points, points_count, IM_COL32(255, 255, 0, 255), false, 1.0f);
+//                     producer.End();                           // Publish. Never blocks.
+//   UI thread:        ImGui::Begin("Scope");
+//                     producer.AddToDrawList(ImGui::GetWindowDrawList(), ImGui::GetCursorScreenPos()); // Or ImGui::GetBackgroundDrawList()
+// Each producer thread uses its own ImDrawListProducer: geometry is tessellated on the producer thread, and the UI thread only copies
+// vertices of the most recently published draw list (which stays visible until a new one is published) clipped to the destination
+// draw list. Many producers and one UI thread never wait for each other. Producers can't use ImGui:: functions, and use a copy of
+// the shared draw list data (font, tessellation settings) made by Init().
+// ImDrawListProducer requires IMGUI_USE_THREAD_LOCAL_CONTEXT: ImDrawList allocations update the allocation counters of the current
+// context (see ImGui::MemAlloc()), which would otherwise be the context of the UI thread, written concurrently by producer threads.
+
+// Changelog:
+// - v0.10: Initial version. Added ImDrawDataTripleBuffer.
+// - v0.11: Added ImDrawListProducer.
+
+#pragma once
+
+#include <atomic>
+
+struct ImDrawDataTripleBuffer
+{
+    // Ownership: _Snapshots[_WriteIdx] belongs to the UI thread, _Snapshots[_ReadIdx] to the render thread,
+    // and the third one is either the latest published frame or one that nobody uses.
+    ImDrawDataSnapshot  _Snapshots[3];
+    int                 _WriteIdx;                  // Only accessed by the UI thread
+    int                 _ReadIdx;                   // Only accessed by the render thread
+    std::atomic<int>    _ExchangeIdx;               // Index of the third buffer, | ExchangeFlag_New when it holds a frame not acquired yet
+    std::atomic<int>    _PublishCount;              // Statistics: number of frames dropped by the render thread == _PublishCount - _AcquireCount
+    std::atomic<int>    _AcquireCount;
+
+    ImDrawDataTripleBuffer();
+
+    // UI thread: call after ImGui::Render(). Swaps the buffers of 'draw_data' into a snapshot (without copying them) and
+    // publishes it. 'draw_data' is cleared and must not be rendered anymore. Never blocks.
+    IMGUI_API void          Publish(ImDrawData* draw_data);
+
+    // Render thread: return the most recently published frame, which stays valid until the next call to Acquire().
+    // Return NULL if nothing was published yet. 'out_is_new' is set to false when this is the same frame as last call. Never blocks.
+    IMGUI_API ImDrawData*   Acquire(bool* out_is_new = NULL);
+
+    // Free all memory. Call when neither thread is using the buffer anymore.
+    IMGUI_API void          Clear();
+};
+
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+struct ImDrawListProducer
+{
+    // Ownership: _Lists[_WriteIdx] belongs to the producer thread, _Lists[_ReadIdx] to the UI thread, as in ImDrawDataTripleBuffer.
+    ImDrawListSharedData*   _Data;                  // Copy of the shared data of the UI context, so the producer never reads data owned by the UI thread
+    ImDrawList*             _Lists[3];
+    int                     _WriteIdx;              // Only accessed by the producer thread
+    int                     _ReadIdx;               // Only accessed by the UI thread
+    bool                    _ReadValid;             // Only accessed by the UI thread: _Lists[_ReadIdx] was published
+    std::atomic<int>        _ExchangeIdx;
+    std::atomic<int>        _PublishCount;          // Statistics: number of draw lists dropped == _PublishCount - _AcquireCount
+    std::atomic<int>        _AcquireCount;
+
+    ImDrawListProducer();
+    ~ImDrawListProducer()   { Shutdown(); }
+
+    // UI thread: call between NewFrame() and Render(), before the producer thread calls Begin(). Shutdown() when the producer thread is done.
+    IMGUI_API void          Init();
+    IMGUI_API void          Shutdown();
+
+    // Producer thread: return a cleared draw list to draw into, with the default font texture and no clipping. End() publishes it.
+    IMGUI_API ImDrawList*   Begin();
+    IMGUI_API void          End();
+
+    // UI thread: append the most recently published draw list to 'draw_list', translated by 'offset' and clipped by its current clip rectangle.
+    IMGUI_API void          AddToDrawList(ImDrawList* draw_list, const ImVec2& offset = ImVec2(0.0f, 0.0f));
+};
+#endif // #ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT